@@ -0,0 +1,707 @@
+/*************************************************************************
+* Title: Arbitrary Precision Integer Class
+* File: bigint.h
+* Date: 10/19/2026
+*
+* Signed integer of unbounded size, usable as Polynomial coefficient type
+* for exact computations that overflow int and long long.
+*
+* Notes:
+*  (1) Sign and magnitude, magnitude in 32-bit limbs, least significant
+*      first. Multiplication is Karatsuba above a cutoff, division is
+*      Knuth's algorithm D. Division truncates toward zero, like int.
+*  (2) Polynomial<BigInt> multiplies dense operands by Kronecker
+*      substitution: each coefficient array is packed into one integer
+*      at a slot width wide enough for every product coefficient, the two
+*      integers are multiplied once, and the coefficients are unpacked
+*      from the slots. This replaces n * m small bignum products by one
+*      large one.
+*************************************************************************
+* Change Log:
+*   10/19/2026: Initial release.
+*   10/19/2026: Added conversion to long long.
+*   10/19/2026: Added log2, finite where the conversion to double is not.
+*************************************************************************/
+#pragma once
+
+#include <vector>    // limbs
+#include <string>    // decimal conversion
+#include <cstdint>   // uint32_t, uint64_t
+#include <stdexcept> // overflow_error, invalid_argument
+#include <algorithm> // max, min, reverse
+#include <functional> // hash
+#include <cmath>     // log2, ldexp
+#include <limits>    // infinity
+#include <ostream>
+
+#include "polynomial.h"
+
+class BigInt
+{
+	// Kronecker substitution packs and unpacks limbs directly.
+	friend struct DenseProduct<BigInt>;
+
+private:
+	typedef std::vector<std::uint32_t> Limbs;
+
+	// Magnitude, no leading zero limbs. Empty for zero.
+	Limbs limbs;
+	// Sign, never set for zero.
+	bool negative = false;
+
+	// Limb count below which schoolbook multiplication beats Karatsuba.
+	static const std::size_t karatsubaCutoff = 32;
+
+	// Construct from magnitude and sign.
+	BigInt(Limbs l, const bool n) : limbs(std::move(l)), negative(n) { trim(); }
+
+	// Drop leading zero limbs, clear sign of zero.
+	void trim();
+
+	// Compare magnitudes, returns -1, 0 or 1.
+	static int compareMagnitude(const Limbs& a, const Limbs& b);
+	// Add b shifted left by offset limbs into a.
+	static void addMagnitude(Limbs& a, const Limbs& b, const std::size_t offset = 0);
+	// Subtract b from a, requires a >= b.
+	static void subtractMagnitude(Limbs& a, const Limbs& b);
+	// Multiply magnitudes.
+	static Limbs multiplyMagnitude(const Limbs& a, const Limbs& b);
+	// Divide magnitudes into quotient and remainder.
+	static void divideMagnitude(const Limbs& a, const Limbs& b, Limbs& quotient, Limbs& remainder);
+	// Multiply magnitude by small factor and add small term, in place.
+	static void multiplyAddSmall(Limbs& a, const std::uint32_t factor, const std::uint32_t term);
+	// Divide magnitude by small divisor in place, returns remainder.
+	static std::uint32_t divideSmall(Limbs& a, const std::uint32_t divisor);
+
+	// Signed sum of a and b, with b's sign flipped if subtract is set.
+	static BigInt add(const BigInt& a, const BigInt& b, const bool subtract);
+
+public:
+	// Zero.
+	BigInt() = default;
+	// Convert from built in integer.
+	BigInt(const long long value);
+	// Parse decimal string with optional sign.
+	explicit BigInt(const std::string& decimal);
+
+	// Number of bits in the magnitude, zero for zero.
+	std::size_t bitLength() const;
+	// Base 2 logarithm of the magnitude, minus infinity for zero.
+	double log2() const;
+	// Decimal representation.
+	std::string toString() const;
+
+	// Non-zero test.
+	explicit operator bool() const { return !limbs.empty(); }
+	// Nearest double (may be infinite).
+	explicit operator double() const;
+	// Value as long long, for values that fit.
+	explicit operator long long() const;
+
+	// Overloaded unary minus operator.
+	BigInt operator- () const { BigInt result = *this; result.negative = !result.limbs.empty() && !negative; return result; }
+
+	friend BigInt operator+ (const BigInt& a, const BigInt& b) { return add(a, b, false); }
+	friend BigInt operator- (const BigInt& a, const BigInt& b) { return add(a, b, true); }
+	friend BigInt operator* (const BigInt& a, const BigInt& b) { return BigInt(multiplyMagnitude(a.limbs, b.limbs), a.negative != b.negative); }
+	friend BigInt operator/ (const BigInt& a, const BigInt& b);
+	friend BigInt operator% (const BigInt& a, const BigInt& b);
+
+	BigInt& operator+= (const BigInt& rhs) { return *this = *this + rhs; }
+	BigInt& operator-= (const BigInt& rhs) { return *this = *this - rhs; }
+	BigInt& operator*= (const BigInt& rhs) { return *this = *this * rhs; }
+	BigInt& operator/= (const BigInt& rhs) { return *this = *this / rhs; }
+	BigInt& operator%= (const BigInt& rhs) { return *this = *this % rhs; }
+
+	friend bool operator== (const BigInt& a, const BigInt& b) { return a.negative == b.negative && a.limbs == b.limbs; }
+	friend bool operator!= (const BigInt& a, const BigInt& b) { return !(a == b); }
+	friend bool operator< (const BigInt& a, const BigInt& b)
+	{
+		if (a.negative != b.negative)
+			return a.negative;
+
+		return a.negative ? compareMagnitude(b.limbs, a.limbs) < 0 : compareMagnitude(a.limbs, b.limbs) < 0;
+	}
+	friend bool operator> (const BigInt& a, const BigInt& b) { return b < a; }
+	friend bool operator<= (const BigInt& a, const BigInt& b) { return !(b < a); }
+	friend bool operator>= (const BigInt& a, const BigInt& b) { return !(a < b); }
+
+	// Stream in decimal.
+	friend std::ostream& operator<< (std::ostream& os, const BigInt& x) { return os << x.toString(); }
+
+	// Hash of sign and magnitude.
+	std::size_t hash() const;
+};
+
+// Absolute value.
+inline BigInt abs(const BigInt& x) { return x < BigInt() ? -x : x; }
+
+// Integer power by repeated squaring.
+inline BigInt pow(BigInt x, unsigned exponent)
+{
+	BigInt result(1);
+
+	for (; exponent; exponent >>= 1)
+	{
+		if (exponent & 1)
+			result *= x;
+		if (exponent > 1)
+			x *= x;
+	}
+
+	return result;
+}
+
+namespace std
+{
+	template<>
+	struct hash<BigInt>
+	{
+		std::size_t operator() (const BigInt& x) const { return x.hash(); }
+	};
+}
+
+// Convert from built in integer.
+inline BigInt::BigInt(const long long value) : negative(value < 0)
+{
+	// Negate as unsigned so the most negative value works.
+	std::uint64_t magnitude = negative ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+
+	for (; magnitude; magnitude >>= 32)
+		limbs.push_back(static_cast<std::uint32_t>(magnitude));
+}
+
+// Parse decimal string with optional sign.
+inline BigInt::BigInt(const std::string& decimal)
+{
+	std::size_t i = 0;
+	bool minus = false;
+
+	if (!decimal.empty() && (decimal[0] == '-' || decimal[0] == '+'))
+		minus = decimal[i++] == '-';
+
+	if (i == decimal.size())
+		throw std::invalid_argument("BigInt: no digits");
+
+	for (; i < decimal.size(); i++)
+	{
+		if (decimal[i] < '0' || decimal[i] > '9')
+			throw std::invalid_argument("BigInt: invalid digit");
+		multiplyAddSmall(limbs, 10, static_cast<std::uint32_t>(decimal[i] - '0'));
+	}
+
+	negative = minus;
+	trim();
+}
+
+// Drop leading zero limbs, clear sign of zero.
+inline void BigInt::trim()
+{
+	while (!limbs.empty() && limbs.back() == 0)
+		limbs.pop_back();
+
+	if (limbs.empty())
+		negative = false;
+}
+
+// Compare magnitudes, returns -1, 0 or 1.
+inline int BigInt::compareMagnitude(const Limbs& a, const Limbs& b)
+{
+	if (a.size() != b.size())
+		return a.size() < b.size() ? -1 : 1;
+
+	for (std::size_t i = a.size(); i-- > 0; )
+		if (a[i] != b[i])
+			return a[i] < b[i] ? -1 : 1;
+
+	return 0;
+}
+
+// Add b shifted left by offset limbs into a.
+inline void BigInt::addMagnitude(Limbs& a, const Limbs& b, const std::size_t offset)
+{
+	if (a.size() < offset + b.size())
+		a.resize(offset + b.size(), 0);
+
+	std::uint64_t carry = 0;
+	std::size_t i = 0;
+
+	for (; i < b.size(); i++)
+	{
+		carry += std::uint64_t{ a[offset + i] } + b[i];
+		a[offset + i] = static_cast<std::uint32_t>(carry);
+		carry >>= 32;
+	}
+
+	for (i += offset; carry; i++)
+	{
+		if (i == a.size())
+			a.push_back(0);
+		carry += a[i];
+		a[i] = static_cast<std::uint32_t>(carry);
+		carry >>= 32;
+	}
+}
+
+// Subtract b from a, requires a >= b.
+inline void BigInt::subtractMagnitude(Limbs& a, const Limbs& b)
+{
+	std::int64_t borrow = 0;
+
+	for (std::size_t i = 0; i < a.size() && (i < b.size() || borrow); i++)
+	{
+		std::int64_t t = std::int64_t{ a[i] } - borrow - (i < b.size() ? std::int64_t{ b[i] } : 0);
+		borrow = t < 0;
+		a[i] = static_cast<std::uint32_t>(t + (borrow << 32));
+	}
+
+	while (!a.empty() && a.back() == 0)
+		a.pop_back();
+}
+
+// Multiply magnitudes.
+//
+// Karatsuba: with a = a1 B^m + a0 and b = b1 B^m + b0,
+//   a b = a1 b1 B^2m + ((a0 + a1)(b0 + b1) - a0 b0 - a1 b1) B^m + a0 b0.
+// An operand shorter than the split is multiplied against both halves of
+// the other instead.
+inline BigInt::Limbs BigInt::multiplyMagnitude(const Limbs& a, const Limbs& b)
+{
+	if (a.empty() || b.empty())
+		return Limbs();
+
+	// Schoolbook multiplication for small operands.
+	if (std::min(a.size(), b.size()) < karatsubaCutoff)
+	{
+		Limbs product(a.size() + b.size(), 0);
+
+		for (std::size_t i = 0; i < a.size(); i++)
+		{
+			std::uint64_t carry = 0;
+
+			for (std::size_t j = 0; j < b.size(); j++)
+			{
+				carry += std::uint64_t{ a[i] } * b[j] + product[i + j];
+				product[i + j] = static_cast<std::uint32_t>(carry);
+				carry >>= 32;
+			}
+			product[i + b.size()] = static_cast<std::uint32_t>(carry);
+		}
+
+		while (!product.empty() && product.back() == 0)
+			product.pop_back();
+
+		return product;
+	}
+
+	const std::size_t m = std::max(a.size(), b.size()) / 2;
+
+	auto low = [m](const Limbs& x) { Limbs l(x.begin(), x.begin() + std::min(m, x.size())); while (!l.empty() && l.back() == 0) l.pop_back(); return l; };
+	auto high = [m](const Limbs& x) { return x.size() > m ? Limbs(x.begin() + m, x.end()) : Limbs(); };
+
+	// Unbalanced operands.
+	if (a.size() <= m || b.size() <= m)
+	{
+		const Limbs& shorter = a.size() <= m ? a : b;
+		const Limbs& longer = a.size() <= m ? b : a;
+
+		Limbs product = multiplyMagnitude(shorter, low(longer));
+		addMagnitude(product, multiplyMagnitude(shorter, high(longer)), m);
+
+		return product;
+	}
+
+	const Limbs a0 = low(a), a1 = high(a), b0 = low(b), b1 = high(b);
+
+	const Limbs z0 = multiplyMagnitude(a0, b0);
+	const Limbs z2 = multiplyMagnitude(a1, b1);
+
+	Limbs sumA = a0, sumB = b0;
+	addMagnitude(sumA, a1);
+	addMagnitude(sumB, b1);
+
+	Limbs z1 = multiplyMagnitude(sumA, sumB);
+	subtractMagnitude(z1, z0);
+	subtractMagnitude(z1, z2);
+
+	Limbs product = z0;
+	addMagnitude(product, z1, m);
+	addMagnitude(product, z2, 2 * m);
+
+	return product;
+}
+
+// Divide magnitudes into quotient and remainder.
+//
+// Knuth's algorithm D: the divisor is normalized so its top limb has the
+// high bit set, then each quotient limb is estimated from the top two
+// limbs of the remainder, corrected at most twice.
+inline void BigInt::divideMagnitude(const Limbs& a, const Limbs& b, Limbs& quotient, Limbs& remainder)
+{
+	if (b.empty())
+		throw std::overflow_error("BigInt: divide by zero");
+
+	if (compareMagnitude(a, b) < 0)
+	{
+		quotient.clear();
+		remainder = a;
+		return;
+	}
+
+	if (b.size() == 1)
+	{
+		quotient = a;
+		const std::uint32_t r = divideSmall(quotient, b[0]);
+		remainder = r ? Limbs{ r } : Limbs();
+		return;
+	}
+
+	// Normalize.
+	int shift = 0;
+	while (!(b.back() << shift & 0x80000000u))
+		shift++;
+
+	auto normalize = [shift](const Limbs& x, const std::size_t size)
+	{
+		Limbs y(size, 0);
+		for (std::size_t i = 0; i < x.size(); i++)
+		{
+			y[i] |= x[i] << shift;
+			if (shift)
+				y[i + 1] |= x[i] >> (32 - shift);
+		}
+		return y;
+	};
+
+	const std::size_t n = b.size(), m = a.size() - n;
+	const Limbs v = normalize(b, n + 1);
+	Limbs u = normalize(a, a.size() + 1);
+
+	quotient.assign(m + 1, 0);
+
+	for (std::size_t j = m + 1; j-- > 0; )
+	{
+		// Estimate quotient limb from the top two remainder limbs.
+		const std::uint64_t top = (std::uint64_t{ u[j + n] } << 32) | u[j + n - 1];
+		std::uint64_t qhat = top / v[n - 1], rhat = top % v[n - 1];
+
+		while (qhat >> 32 || qhat * v[n - 2] > ((rhat << 32) | u[j + n - 2]))
+		{
+			qhat--;
+			rhat += v[n - 1];
+			if (rhat >> 32)
+				break;
+		}
+
+		// Multiply and subtract.
+		std::int64_t k = 0, t;
+		for (std::size_t i = 0; i < n; i++)
+		{
+			const std::uint64_t p = qhat * v[i];
+			t = std::int64_t{ u[i + j] } - k - static_cast<std::int64_t>(p & 0xFFFFFFFFu);
+			u[i + j] = static_cast<std::uint32_t>(t);
+			k = static_cast<std::int64_t>(p >> 32) - (t >> 32);
+		}
+		t = std::int64_t{ u[j + n] } - k;
+		u[j + n] = static_cast<std::uint32_t>(t);
+
+		// Estimate was one too large, add back.
+		if (t < 0)
+		{
+			qhat--;
+			std::uint64_t carry = 0;
+			for (std::size_t i = 0; i < n; i++)
+			{
+				carry += std::uint64_t{ u[i + j] } + v[i];
+				u[i + j] = static_cast<std::uint32_t>(carry);
+				carry >>= 32;
+			}
+			u[j + n] += static_cast<std::uint32_t>(carry);
+		}
+
+		quotient[j] = static_cast<std::uint32_t>(qhat);
+	}
+
+	// Unnormalize remainder.
+	remainder.assign(n, 0);
+	for (std::size_t i = 0; i < n; i++)
+		remainder[i] = (u[i] >> shift) | (shift ? u[i + 1] << (32 - shift) : 0);
+
+	while (!quotient.empty() && quotient.back() == 0)
+		quotient.pop_back();
+	while (!remainder.empty() && remainder.back() == 0)
+		remainder.pop_back();
+}
+
+// Multiply magnitude by small factor and add small term, in place.
+inline void BigInt::multiplyAddSmall(Limbs& a, const std::uint32_t factor, const std::uint32_t term)
+{
+	std::uint64_t carry = term;
+
+	for (auto& limb : a)
+	{
+		carry += std::uint64_t{ limb } * factor;
+		limb = static_cast<std::uint32_t>(carry);
+		carry >>= 32;
+	}
+
+	if (carry)
+		a.push_back(static_cast<std::uint32_t>(carry));
+}
+
+// Divide magnitude by small divisor in place, returns remainder.
+inline std::uint32_t BigInt::divideSmall(Limbs& a, const std::uint32_t divisor)
+{
+	std::uint64_t remainder = 0;
+
+	for (std::size_t i = a.size(); i-- > 0; )
+	{
+		remainder = (remainder << 32) | a[i];
+		a[i] = static_cast<std::uint32_t>(remainder / divisor);
+		remainder %= divisor;
+	}
+
+	while (!a.empty() && a.back() == 0)
+		a.pop_back();
+
+	return static_cast<std::uint32_t>(remainder);
+}
+
+// Signed sum of a and b, with b's sign flipped if subtract is set.
+inline BigInt BigInt::add(const BigInt& a, const BigInt& b, const bool subtract)
+{
+	const bool bNegative = b.negative != subtract;
+
+	// Same signs add magnitudes.
+	if (a.negative == bNegative)
+	{
+		Limbs sum = a.limbs;
+		addMagnitude(sum, b.limbs);
+		return BigInt(std::move(sum), a.negative);
+	}
+
+	// Opposite signs subtract the smaller magnitude from the larger.
+	if (compareMagnitude(a.limbs, b.limbs) >= 0)
+	{
+		Limbs difference = a.limbs;
+		subtractMagnitude(difference, b.limbs);
+		return BigInt(std::move(difference), a.negative);
+	}
+
+	Limbs difference = b.limbs;
+	subtractMagnitude(difference, a.limbs);
+	return BigInt(std::move(difference), bNegative);
+}
+
+// Quotient, truncated toward zero.
+inline BigInt operator/ (const BigInt& a, const BigInt& b)
+{
+	BigInt::Limbs quotient, remainder;
+	BigInt::divideMagnitude(a.limbs, b.limbs, quotient, remainder);
+
+	return BigInt(std::move(quotient), a.negative != b.negative);
+}
+
+// Remainder, with the sign of the dividend.
+inline BigInt operator% (const BigInt& a, const BigInt& b)
+{
+	BigInt::Limbs quotient, remainder;
+	BigInt::divideMagnitude(a.limbs, b.limbs, quotient, remainder);
+
+	return BigInt(std::move(remainder), a.negative);
+}
+
+// Number of bits in the magnitude, zero for zero.
+inline std::size_t BigInt::bitLength() const
+{
+	if (limbs.empty())
+		return 0;
+
+	std::size_t bits = 32 * (limbs.size() - 1);
+	for (std::uint32_t top = limbs.back(); top; top >>= 1)
+		bits++;
+
+	return bits;
+}
+
+// Base 2 logarithm of the magnitude: bit length plus the log of the top
+// 64 bits as a mantissa in [1, 2), so no double overflow at any size.
+inline double BigInt::log2() const
+{
+	if (limbs.empty())
+		return -std::numeric_limits<double>::infinity();
+
+	const std::size_t bits = bitLength();
+
+	// Top three limbs hold at least 65 significant bits.
+	double top = 0.;
+	const std::size_t count = std::min<std::size_t>(limbs.size(), 3);
+	for (std::size_t i = limbs.size(); i-- > limbs.size() - count; )
+		top = top * 4294967296. + limbs[i];
+
+	const double mantissa = std::ldexp(top, -static_cast<int>(bits - 32 * (limbs.size() - count)) + 1);
+
+	return double(bits - 1) + std::log2(mantissa);
+}
+
+// Decimal representation, nine digits per short division.
+inline std::string BigInt::toString() const
+{
+	if (limbs.empty())
+		return "0";
+
+	std::string s;
+	Limbs x = limbs;
+
+	while (!x.empty())
+	{
+		std::uint32_t chunk = divideSmall(x, 1000000000u);
+		for (int i = 0; i < 9 && (chunk || !x.empty()); i++, chunk /= 10)
+			s += static_cast<char>('0' + chunk % 10);
+	}
+
+	if (negative)
+		s += '-';
+	std::reverse(s.begin(), s.end());
+
+	return s;
+}
+
+// Nearest double (may be infinite).
+inline BigInt::operator double() const
+{
+	double x = 0.;
+
+	for (std::size_t i = limbs.size(); i-- > 0; )
+		x = x * 4294967296. + limbs[i];
+
+	return negative ? -x : x;
+}
+
+// Value as long long, for values that fit.
+inline BigInt::operator long long() const
+{
+	std::uint64_t magnitude = 0;
+
+	for (std::size_t i = std::min<std::size_t>(limbs.size(), 2); i-- > 0; )
+		magnitude = (magnitude << 32) | limbs[i];
+
+	return static_cast<long long>(negative ? 0 - magnitude : magnitude);
+}
+
+// Hash of sign and magnitude.
+inline std::size_t BigInt::hash() const
+{
+	std::uint64_t h = negative ? 0x9E3779B97F4A7C15ull : 0;
+
+	for (auto limb : limbs)
+	{
+		h = (h ^ limb) * 0xBF58476D1CE4E5B9ull;
+		h ^= h >> 31;
+	}
+
+	return static_cast<std::size_t>(h);
+}
+
+// Kronecker substitution product of BigInt coefficient arrays.
+//
+// With every product coefficient below 2^(s-1) in magnitude, packing
+// a(2^s) and b(2^s) into two integers and multiplying them gives the
+// product coefficients as signed s-bit digits of one integer. Digits are
+// read back with a borrow: a digit of 2^(s-1) or more is negative.
+template<>
+struct DenseProduct<BigInt> : std::true_type
+{
+	typedef BigInt::Limbs Limbs;
+
+	// Pack coefficients at slot width s, positive and negative parts apart.
+	static BigInt pack(const std::vector<BigInt>& c, const std::size_t s)
+	{
+		const std::size_t size = (c.size() * s + 31) / 32 + 1;
+		Limbs positive(size, 0), negative(size, 0);
+
+		// Slots do not overlap, so digits are or-ed into place.
+		for (std::size_t i = 0; i < c.size(); i++)
+		{
+			Limbs& out = c[i].negative ? negative : positive;
+			const std::size_t offset = i * s;
+
+			for (std::size_t k = 0; k < c[i].limbs.size(); k++)
+			{
+				const std::size_t bit = offset + 32 * k;
+				const std::uint64_t w = std::uint64_t{ c[i].limbs[k] } << (bit % 32);
+
+				out[bit / 32] |= static_cast<std::uint32_t>(w);
+				if (w >> 32)
+					out[bit / 32 + 1] |= static_cast<std::uint32_t>(w >> 32);
+			}
+		}
+
+		return BigInt(std::move(positive), false) - BigInt(std::move(negative), false);
+	}
+
+	// Read s bits of x starting at bit offset.
+	static Limbs slot(const Limbs& x, const std::size_t offset, const std::size_t s)
+	{
+		Limbs field((s + 31) / 32, 0);
+
+		for (std::size_t k = 0; k < field.size(); k++)
+		{
+			const std::size_t bit = offset + 32 * k, i = bit / 32, shift = bit % 32;
+
+			std::uint64_t w = i < x.size() ? x[i] : 0;
+			if (shift && i + 1 < x.size())
+				w |= std::uint64_t{ x[i + 1] } << 32;
+			field[k] = static_cast<std::uint32_t>(w >> shift);
+		}
+
+		// Mask bits above s.
+		if (s % 32)
+			field.back() &= (std::uint32_t{ 1 } << (s % 32)) - 1;
+
+		return field;
+	}
+
+	// Multiply coefficient arrays.
+	static std::vector<BigInt> multiply(const std::vector<BigInt>& a, const std::vector<BigInt>& b)
+	{
+		std::size_t bitsA = 0, bitsB = 0;
+		for (auto& x : a)
+			bitsA = std::max(bitsA, x.bitLength());
+		for (auto& x : b)
+			bitsB = std::max(bitsB, x.bitLength());
+
+		std::vector<BigInt> result(a.size() + b.size() - 1);
+		if (bitsA == 0 || bitsB == 0)
+			return result;
+
+		// Product coefficients are sums of min(n, m) products, plus a sign bit.
+		std::size_t s = bitsA + bitsB + 1;
+		for (std::size_t n = std::min(a.size(), b.size()); n; n >>= 1)
+			s++;
+
+		const BigInt product = pack(a, s) * pack(b, s);
+
+		Limbs halfLimbs((s + 31) / 32, 0), fullLimbs(s / 32 + 1, 0);
+		halfLimbs[(s - 1) / 32] = std::uint32_t{ 1 } << ((s - 1) % 32);
+		fullLimbs[s / 32] = std::uint32_t{ 1 } << (s % 32);
+		const BigInt halfSlot(std::move(halfLimbs), false), fullSlot(std::move(fullLimbs), false);
+
+		// Unpack signed digits, borrowing from the next slot for negative ones.
+		bool borrow = false;
+		for (std::size_t i = 0; i < result.size(); i++)
+		{
+			BigInt digit(slot(product.limbs, i * s, s), false);
+			if (borrow)
+				digit += BigInt(1);
+
+			borrow = digit >= halfSlot;
+			if (borrow)
+				digit -= fullSlot;
+
+			result[i] = product.negative ? -digit : digit;
+		}
+
+		return result;
+	}
+};
@@ -0,0 +1,455 @@
+/*************************************************************************
+* Title: Chebyshev Polynomial Class
+* File: chebyshev.h
+* Date: 10/19/2026
+*
+* Polynomial kept as coefficients of the Chebyshev polynomials T_k(x),
+* p(x) = c_0 T_0(x) + c_1 T_1(x) + ... + c_n T_n(x), the numerically
+* stable basis for approximation on [-1, 1].
+*
+* Notes:
+*  (1) Evaluation uses Clenshaw's recurrence, also in a batched form that
+*      runs the recurrence for many points at once over contiguous arrays.
+*  (2) Values at the n + 1 Chebyshev points x_j = cos(pi j / n) and the
+*      coefficients are related by a type-I discrete cosine transform,
+*      computed with an FFT in O(n log n) for any n. Multiplication and
+*      interpolation go through it.
+*  (3) Conversion to and from Polynomial is divide and conquer over
+*      T_(2^i) (or x^(2^i)) with fast products, instead of the O(n^2)
+*      three-term recurrences.
+*  (4) Floating point coefficients only.
+*************************************************************************
+* Change Log:
+*   10/19/2026: Initial release.
+*   10/19/2026: FFT moved to fft.h.
+*   10/19/2026: Interpolation uses exactly n + 1 points for any n; stream
+*               output leaves the stream's format flags alone.
+*************************************************************************/
+#pragma once
+
+#include <vector>    // coefficients
+#include <complex>   // FFT
+#include <cmath>     // cos
+#include <algorithm> // max, min
+#include <type_traits>
+
+#include "polynomial.h"
+#include "fft.h"
+
+template<typename T>
+class ChebyshevPolynomial
+{
+	static_assert(std::is_floating_point<T>::value, "ChebyshevPolynomial requires floating point coefficients");
+
+private:
+	// Coefficients of T_0 ... T_degree, no trailing zeros.
+	std::vector<T> coefficients;
+
+	// Degree below which products and conversions use the direct O(n^2) forms.
+	static const std::size_t directCutoff = 32;
+
+	// Drop trailing zero coefficients.
+	void trim();
+
+	// Type-I DCT of n + 1 samples:
+	//   y_k = f_0 + (-1)^k f_n + 2 sum_{0 < j < n} f_j cos(pi j k / n).
+	static std::vector<T> dct(const std::vector<T>& f);
+
+	// Convert monomial coefficients a[first, last) to Chebyshev coefficients,
+	// given x^(2^i) in Chebyshev form as powers[i].
+	static std::vector<T> fromMonomial(const std::vector<T>& a, const std::size_t first, const std::size_t last,
+		const std::vector<ChebyshevPolynomial>& powers);
+	// Convert Chebyshev coefficients c to a monomial Polynomial, c.size() a power of two,
+	// given T_(2^i) in monomial form as powers[i].
+	static Polynomial<T> toMonomial(std::vector<T> c, const std::vector<Polynomial<T>>& powers);
+
+public:
+	// Zero polynomial.
+	ChebyshevPolynomial() = default;
+	// From Chebyshev coefficients c_0 ... c_n.
+	explicit ChebyshevPolynomial(std::vector<T> c) : coefficients(std::move(c)) { trim(); }
+	// Convert from monomial basis.
+	explicit ChebyshevPolynomial(const Polynomial<T>& p);
+
+	// Interpolate f at the n + 1 Chebyshev points of [-1, 1].
+	template<typename Function>
+	static ChebyshevPolynomial interpolate(Function f, const std::size_t n);
+
+	// Convert to monomial basis.
+	Polynomial<T> toPolynomial() const;
+
+	// Getter function for polynomial degree.
+	std::size_t getDegree() const { return coefficients.empty() ? 0 : coefficients.size() - 1; }
+	// Return coefficient of T_k, zero above the degree.
+	T operator[] (const std::size_t k) const { return k < coefficients.size() ? coefficients[k] : T{ 0 }; }
+
+	// Evaluate at x by Clenshaw's recurrence.
+	T evaluate(const T x) const;
+	// Evaluate at x[i] into y[i] for i < count.
+	void evaluate(const T* x, T* y, const std::size_t count) const;
+
+	// Add polynomials.
+	ChebyshevPolynomial operator+ (const ChebyshevPolynomial& rhs) const;
+	// Subtract polynomials.
+	ChebyshevPolynomial operator- (const ChebyshevPolynomial& rhs) const;
+	// Multiply polynomials, via the DCT for large operands.
+	ChebyshevPolynomial operator* (const ChebyshevPolynomial& rhs) const;
+
+	// Overload equality operator.
+	bool operator== (const ChebyshevPolynomial& rhs) const { return coefficients == rhs.coefficients; }
+	bool operator!= (const ChebyshevPolynomial& rhs) const { return !(*this == rhs); }
+
+	// Stream polynomial as sum of c_k T_k.
+	friend std::ostream& operator<< (std::ostream& os, const ChebyshevPolynomial& p)
+	{
+		if (p.coefficients.empty())
+			return os << "0";
+
+		for (std::size_t k = p.coefficients.size(); k-- > 0; )
+		{
+			if (p.coefficients[k] == T{ 0 })
+				continue;
+			if (k + 1 != p.coefficients.size())
+				os << (p.coefficients[k] < T{ 0 } ? " - " : " + ");
+			else if (p.coefficients[k] < T{ 0 })
+				os << "-";
+
+			// Format in a local stream, so the caller's flags are untouched.
+			std::stringstream ss;
+			ss << std::fixed << std::setprecision(1) << std::abs(p.coefficients[k]) << "T_" << k;
+			os << ss.str();
+		}
+
+		return os;
+	}
+};
+
+// Drop trailing zero coefficients.
+template<typename T>
+void ChebyshevPolynomial<T>::trim()
+{
+	while (!coefficients.empty() && coefficients.back() == T{ 0 })
+		coefficients.pop_back();
+}
+
+// Type-I DCT of n + 1 samples, as the FFT of their even extension of length 2n.
+template<typename T>
+std::vector<T> ChebyshevPolynomial<T>::dct(const std::vector<T>& f)
+{
+	const std::size_t n = f.size() - 1;
+
+	if (n == 0)
+		return f;
+
+	std::vector<std::complex<T>> y(2 * n);
+	for (std::size_t j = 0; j <= n; j++)
+		y[j] = f[j];
+	for (std::size_t j = 1; j < n; j++)
+		y[2 * n - j] = f[j];
+
+	dft(y);
+
+	std::vector<T> result(n + 1);
+	for (std::size_t k = 0; k <= n; k++)
+		result[k] = y[k].real();
+
+	return result;
+}
+
+// Convert monomial coefficients a[first, last) to Chebyshev coefficients.
+//
+// With a = lo + x^m hi, cheb(a) = cheb(lo) + cheb(x^m) cheb(hi), where the
+// product is the DCT-based Chebyshev multiplication.
+template<typename T>
+std::vector<T> ChebyshevPolynomial<T>::fromMonomial(const std::vector<T>& a, const std::size_t first, const std::size_t last,
+	const std::vector<ChebyshevPolynomial<T>>& powers)
+{
+	if (last - first <= directCutoff)
+	{
+		// Horner's rule in the Chebyshev basis, x T_k = (T_(k+1) + T_(k-1)) / 2.
+		std::vector<T> c;
+
+		for (std::size_t i = last; i-- > first; )
+		{
+			std::vector<T> shifted(c.size() + 1, T{ 0 });
+			for (std::size_t k = 0; k < c.size(); k++)
+			{
+				if (k == 0)
+					shifted[1] += c[0];
+				else
+				{
+					shifted[k + 1] += c[k] / 2;
+					shifted[k - 1] += c[k] / 2;
+				}
+			}
+			shifted[0] += a[i];
+			c.swap(shifted);
+		}
+
+		return c;
+	}
+
+	// Split at the largest power of two below the length.
+	std::size_t i = 0;
+	while ((std::size_t(2) << i) < last - first)
+		i++;
+	const std::size_t m = std::size_t(1) << i;
+
+	ChebyshevPolynomial<T> lo(fromMonomial(a, first, first + m, powers));
+	ChebyshevPolynomial<T> hi(fromMonomial(a, first + m, last, powers));
+
+	return (lo + powers[i] * hi).coefficients;
+}
+
+// Convert Chebyshev coefficients c to a monomial Polynomial, c.size() a power of two.
+//
+// With n = 2m, T_(m+j) = 2 T_m T_j - T_(m-j) folds the upper half into
+// c_lo + T_m g, where both halves have m coefficients and T_m is known in
+// monomial form. Costs O(M(n) log n) with Karatsuba products.
+template<typename T>
+Polynomial<T> ChebyshevPolynomial<T>::toMonomial(std::vector<T> c, const std::vector<Polynomial<T>>& powers)
+{
+	const std::size_t n = c.size();
+
+	if (n <= directCutoff)
+	{
+		// Sum c_k T_k with T_k from the three-term recurrence.
+		std::vector<T> result(n, T{ 0 }), previous(n, T{ 0 }), current(n, T{ 0 });
+
+		if (n > 0)
+			previous[0] = T{ 1 };
+		if (n > 1)
+			current[1] = T{ 1 };
+
+		for (std::size_t k = 0; k < n; k++)
+		{
+			const std::vector<T>& t = (k == 0) ? previous : current;
+			for (std::size_t i = 0; i <= k; i++)
+				result[i] += c[k] * t[i];
+
+			if (k >= 1 && k + 1 < n)
+			{
+				// T_(k+1) = 2 x T_k - T_(k-1).
+				std::vector<T> next(n, T{ 0 });
+				for (std::size_t i = 0; i <= k; i++)
+					next[i + 1] += 2 * current[i];
+				for (std::size_t i = 0; i < n; i++)
+					next[i] -= previous[i];
+				previous.swap(current);
+				current.swap(next);
+			}
+		}
+
+		return Polynomial<T>::fromDense(result);
+	}
+
+	std::size_t i = 0;
+	while ((std::size_t(2) << i) < n)
+		i++;
+	const std::size_t m = n / 2;
+	std::vector<T> lo(c.begin(), c.begin() + m), g(m);
+
+	g[0] = c[m];
+	for (std::size_t j = 1; j < m; j++)
+	{
+		g[j] = 2 * c[m + j];
+		lo[m - j] -= c[m + j];
+	}
+
+	return toMonomial(lo, powers) + powers[i] * toMonomial(g, powers);
+}
+
+// Convert from monomial basis.
+template<typename T>
+ChebyshevPolynomial<T>::ChebyshevPolynomial(const Polynomial<T>& p)
+{
+	const std::vector<T> a = p.toDense();
+
+	// x^(2^i) by repeated squaring, up to half the length.
+	std::vector<ChebyshevPolynomial<T>> powers{ ChebyshevPolynomial<T>(std::vector<T>{ T{ 0 }, T{ 1 } }) };
+	while ((std::size_t(1) << powers.size()) < a.size())
+		powers.push_back(powers.back() * powers.back());
+
+	coefficients = fromMonomial(a, 0, a.size(), powers);
+	trim();
+}
+
+// Convert to monomial basis.
+template<typename T>
+Polynomial<T> ChebyshevPolynomial<T>::toPolynomial() const
+{
+	// Pad to a power of two for the halving recursion.
+	std::size_t n = 1;
+	while (n < coefficients.size())
+		n *= 2;
+
+	std::vector<T> c(coefficients);
+	c.resize(n, T{ 0 });
+
+	// T_(2^i) from T_2m = 2 T_m^2 - 1, up to half the length.
+	const Polynomial<T> one({ { 0, T{ 1 } } });
+	std::vector<Polynomial<T>> powers{ Polynomial<T>({ { 1, T{ 1 } } }) };
+	while ((std::size_t(1) << powers.size()) <= n / 2)
+	{
+		const Polynomial<T> square = powers.back() * powers.back();
+		powers.push_back(square + square - one);
+	}
+
+	return toMonomial(c, powers);
+}
+
+// Interpolate f at the n + 1 Chebyshev points of [-1, 1].
+//
+// Samples at x_j = cos(pi j / n), j = 0 ... n, are turned into the n + 1
+// coefficients by one DCT: c_k = y_k / n, halved for k = 0, n. For n = 0
+// the single point is x_0 = 1.
+template<typename T>
+template<typename Function>
+ChebyshevPolynomial<T> ChebyshevPolynomial<T>::interpolate(Function f, const std::size_t n)
+{
+	const T pi = T(3.14159265358979323846264338327950288);
+
+	if (n == 0)
+		return ChebyshevPolynomial<T>(std::vector<T>{ f(T{ 1 }) });
+
+	std::vector<T> values(n + 1);
+	for (std::size_t j = 0; j <= n; j++)
+		values[j] = f(std::cos(pi * T(j) / T(n)));
+
+	std::vector<T> c = dct(values);
+	for (auto& x : c)
+		x /= T(n);
+	c.front() /= 2;
+	c.back() /= 2;
+
+	return ChebyshevPolynomial<T>(c);
+}
+
+// Evaluate at x by Clenshaw's recurrence.
+template<typename T>
+T ChebyshevPolynomial<T>::evaluate(const T x) const
+{
+	// b_k = c_k + 2 x b_(k+1) - b_(k+2), p(x) = c_0 + x b_1 - b_2.
+	T b1{ 0 }, b2{ 0 };
+
+	for (std::size_t k = coefficients.size(); k-- > 1; )
+	{
+		const T b = coefficients[k] + 2 * x * b1 - b2;
+		b2 = b1;
+		b1 = b;
+	}
+
+	return (coefficients.empty() ? T{ 0 } : coefficients[0]) + x * b1 - b2;
+}
+
+// Evaluate at x[i] into y[i] for i < count.
+//
+// Clenshaw's recurrence with the coefficient loop outside and the point
+// loop inside, over contiguous arrays the compiler can vectorize.
+template<typename T>
+void ChebyshevPolynomial<T>::evaluate(const T* x, T* y, const std::size_t count) const
+{
+	std::vector<T> b1(count, T{ 0 }), b2(count, T{ 0 });
+
+	for (std::size_t k = coefficients.size(); k-- > 1; )
+	{
+		const T c = coefficients[k];
+
+		for (std::size_t i = 0; i < count; i++)
+		{
+			const T b = c + 2 * x[i] * b1[i] - b2[i];
+			b2[i] = b1[i];
+			b1[i] = b;
+		}
+	}
+
+	const T c0 = coefficients.empty() ? T{ 0 } : coefficients[0];
+	for (std::size_t i = 0; i < count; i++)
+		y[i] = c0 + x[i] * b1[i] - b2[i];
+}
+
+// Add polynomials.
+template<typename T>
+ChebyshevPolynomial<T> ChebyshevPolynomial<T>::operator+ (const ChebyshevPolynomial<T>& rhs) const
+{
+	std::vector<T> c(std::max(coefficients.size(), rhs.coefficients.size()), T{ 0 });
+
+	for (std::size_t k = 0; k < c.size(); k++)
+		c[k] = (*this)[k] + rhs[k];
+
+	return ChebyshevPolynomial<T>(c);
+}
+
+// Subtract polynomials.
+template<typename T>
+ChebyshevPolynomial<T> ChebyshevPolynomial<T>::operator- (const ChebyshevPolynomial<T>& rhs) const
+{
+	std::vector<T> c(std::max(coefficients.size(), rhs.coefficients.size()), T{ 0 });
+
+	for (std::size_t k = 0; k < c.size(); k++)
+		c[k] = (*this)[k] - rhs[k];
+
+	return ChebyshevPolynomial<T>(c);
+}
+
+// Multiply polynomials, via the DCT for large operands.
+//
+// T_i T_j = (T_(i+j) + T_|i-j|) / 2 directly for small operands. Otherwise
+// both are sampled at N + 1 Chebyshev points (N >= product degree) by a
+// DCT, multiplied pointwise, and transformed back, in O(n log n).
+template<typename T>
+ChebyshevPolynomial<T> ChebyshevPolynomial<T>::operator* (const ChebyshevPolynomial<T>& rhs) const
+{
+	if (coefficients.empty() || rhs.coefficients.empty())
+		return ChebyshevPolynomial<T>();
+
+	const std::size_t degree = getDegree() + rhs.getDegree();
+
+	if (std::min(coefficients.size(), rhs.coefficients.size()) <= directCutoff)
+	{
+		std::vector<T> c(degree + 1, T{ 0 });
+
+		for (std::size_t i = 0; i < coefficients.size(); i++)
+			for (std::size_t j = 0; j < rhs.coefficients.size(); j++)
+			{
+				const T half = coefficients[i] * rhs.coefficients[j] / 2;
+				c[i + j] += half;
+				c[i > j ? i - j : j - i] += half;
+			}
+
+		return ChebyshevPolynomial<T>(c);
+	}
+
+	std::size_t n = 1;
+	while (n < degree)
+		n *= 2;
+
+	// Values from coefficients, f_j = (dct(c)_j + c_0 + (-1)^j c_n) / 2.
+	auto values = [n](const std::vector<T>& coefficients)
+	{
+		std::vector<T> c(coefficients);
+		c.resize(n + 1, T{ 0 });
+
+		std::vector<T> f = dct(c);
+		for (std::size_t j = 0; j <= n; j++)
+			f[j] = (f[j] + c[0] + ((j & 1) ? -c[n] : c[n])) / 2;
+
+		return f;
+	};
+
+	std::vector<T> f = values(coefficients);
+	const std::vector<T> g = values(rhs.coefficients);
+	for (std::size_t j = 0; j <= n; j++)
+		f[j] *= g[j];
+
+	// Coefficients from values, c_k = dct(f)_k / n, halved at both ends.
+	std::vector<T> c = dct(f);
+	for (auto& x : c)
+		x /= T(n);
+	c.front() /= 2;
+	c.back() /= 2;
+
+	c.resize(degree + 1);
+
+	return ChebyshevPolynomial<T>(c);
+}
@@ -0,0 +1,105 @@
+/*************************************************************************
+* Title: Fast Fourier Transform
+* File: fft.h
+* Date: 10/19/2026
+*
+* In-place iterative radix-2 complex FFT, shared by the transform based
+* products (Chebyshev series, external memory multiplication).
+*
+* Notes:
+*  (1) fft size must be a power of two; dft takes any size, by Bluestein's
+*      chirp-z algorithm over a zero-padded power of two convolution.
+*  (2) The inverse transform is unscaled; divide by the size afterwards.
+*************************************************************************
+* Change Log:
+*   10/19/2026: Initial release.
+*   10/19/2026: Added dft for sizes that are not a power of two.
+*************************************************************************/
+#pragma once
+
+#include <vector>    // data
+#include <complex>   // complex, polar
+#include <utility>   // swap
+
+// In-place radix-2 FFT, or unscaled inverse FFT, of a power of two size.
+template<typename T>
+void fft(std::vector<std::complex<T>>& a, const bool inverse = false)
+{
+	const std::size_t n = a.size();
+	const T pi = T(3.14159265358979323846264338327950288);
+	const T sign = inverse ? T{ 1 } : T{ -1 };
+
+	// Bit reversal permutation.
+	for (std::size_t i = 1, j = 0; i < n; i++)
+	{
+		std::size_t bit = n >> 1;
+		for (; j & bit; bit >>= 1)
+			j ^= bit;
+		j ^= bit;
+		if (i < j)
+			std::swap(a[i], a[j]);
+	}
+
+	// Butterflies, twiddles computed directly to avoid drift.
+	for (std::size_t length = 2; length <= n; length <<= 1)
+	{
+		const std::size_t half = length / 2;
+
+		for (std::size_t k = 0; k < half; k++)
+		{
+			const std::complex<T> w = std::polar(T{ 1 }, sign * 2 * pi * T(k) / T(length));
+
+			for (std::size_t i = k; i < n; i += length)
+			{
+				const std::complex<T> u = a[i], v = a[i + half] * w;
+				a[i] = u + v;
+				a[i + half] = u - v;
+			}
+		}
+	}
+}
+
+// In-place DFT, or unscaled inverse DFT, of any size.
+//
+// With jk = (j^2 + k^2 - (k - j)^2) / 2 the transform is the convolution
+// y_k = w_k sum_j (a_j w_j) conj(w_(k - j)), w_m = exp(-+ i pi m^2 / n),
+// done by power of two FFTs of length at least 2n - 1.
+template<typename T>
+void dft(std::vector<std::complex<T>>& a, const bool inverse = false)
+{
+	const std::size_t n = a.size();
+
+	if ((n & (n - 1)) == 0)
+	{
+		fft(a, inverse);
+		return;
+	}
+
+	const T pi = T(3.14159265358979323846264338327950288);
+	const T sign = inverse ? T{ 1 } : T{ -1 };
+
+	// Chirp, m^2 reduced mod 2n (the period) to keep the angle exact.
+	std::vector<std::complex<T>> w(n);
+	for (std::size_t m = 0; m < n; m++)
+		w[m] = std::polar(T{ 1 }, sign * pi * T((m * m) % (2 * n)) / T(n));
+
+	std::size_t size = 1;
+	while (size < 2 * n - 1)
+		size *= 2;
+
+	std::vector<std::complex<T>> x(size), y(size);
+	for (std::size_t j = 0; j < n; j++)
+		x[j] = a[j] * w[j];
+	y[0] = std::conj(w[0]);
+	for (std::size_t m = 1; m < n; m++)
+		y[m] = y[size - m] = std::conj(w[m]);
+
+	fft(x);
+	fft(y);
+	for (std::size_t i = 0; i < size; i++)
+		x[i] *= y[i];
+	fft(x, true);
+
+	for (std::size_t k = 0; k < n; k++)
+		a[k] = w[k] * x[k] / T(size);
+}
@@ -0,0 +1,471 @@
+/*************************************************************************
+* Title: Multivariate Polynomial Class
+* File: multi_polynomial.h
+* Date: 10/19/2026
+*
+* Sparse polynomial in 1 to 16 variables x0 ... x(n-1).
+*
+* Notes:
+*  (1) A monomial's exponents are packed into one 64-bit word, 64 / n bits
+*      per variable with x0 in the most significant field, so comparing
+*      words is lexicographic order and multiplying monomials is a single
+*      integer addition. The top bit of each field is a guard bit: a sum
+*      that sets it has overflowed, and throws. Exponents are limited to
+*      2^(64/n - 1) - 1, e.g. 7 for 16 variables, 127 for 8 (and
+*      2^31 - 1 for a single variable, which uses 32-bit fields).
+*  (2) Terms are kept in a vector sorted by monomial. Multiplication is a
+*      heap merge like Polynomial::multiplyTerms, producing terms in order.
+*  (3) Evaluation is Horner's rule in x0 with coefficients that are
+*      themselves evaluated by Horner's rule in x1, and so on.
+*************************************************************************
+* Change Log:
+*   10/19/2026: Initial release.
+*************************************************************************/
+#pragma once
+
+#include <vector>    // terms, exponents
+#include <cstdint>   // uint64_t
+#include <stdexcept> // domain_error, overflow_error
+#include <algorithm> // lower_bound, push_heap, pop_heap
+#include <initializer_list>
+#include <ostream>
+
+#include "polynomial.h"
+
+template<typename T>
+class MultiPolynomial
+{
+private:
+	typedef std::pair<std::uint64_t, T> Term;
+
+	// Number of variables.
+	unsigned variables;
+	// Bits per exponent field, guard bit included, at most 32.
+	unsigned bits;
+	// Guard bit of every field.
+	std::uint64_t guards;
+	// Terms in increasing monomial order, no zero coefficients.
+	std::vector<Term> terms;
+
+	// Pack exponents into a monomial word, throws if one does not fit.
+	std::uint64_t pack(const std::vector<unsigned>& exponents) const;
+	// Exponent of variable in monomial.
+	unsigned exponent(const std::uint64_t monomial, const unsigned variable) const;
+	// Product of two monomials, throws on exponent overflow.
+	std::uint64_t multiply(const std::uint64_t a, const std::uint64_t b) const;
+
+	// Throw unless rhs has the same variables.
+	void checkVariables(const MultiPolynomial& rhs) const;
+
+	// x^e by repeated squaring.
+	static T power(T x, unsigned e);
+	// Horner evaluation of terms [first, last), which agree below variable.
+	T evaluate(std::size_t first, const std::size_t last, const unsigned variable, const std::vector<T>& x) const;
+
+public:
+	// Zero polynomial in given number of variables.
+	explicit MultiPolynomial(const unsigned variables);
+	// From (exponents, coefficient) pairs.
+	MultiPolynomial(const unsigned variables, std::initializer_list<std::pair<std::vector<unsigned>, T>> init);
+	// Variable x_i.
+	static MultiPolynomial variable(const unsigned variables, const unsigned i);
+
+	// Univariate p in the chosen variable.
+	static MultiPolynomial fromPolynomial(const Polynomial<T>& p, const unsigned variables, const unsigned variable);
+	// Convert to a univariate Polynomial, requires no other variable to appear.
+	Polynomial<T> toPolynomial(const unsigned variable) const;
+	// Convert to a univariate Polynomial, substituting point[j] for every other variable x_j.
+	Polynomial<T> toPolynomial(const unsigned variable, const std::vector<T>& point) const;
+
+	// Add coefficient to term with given exponents.
+	void setTerm(const std::vector<unsigned>& exponents, const T coefficient);
+	// Coefficient of term with given exponents, zero if absent.
+	T getTerm(const std::vector<unsigned>& exponents) const;
+
+	// Getter functions for variable count, term count and total degree.
+	unsigned getVariables() const { return variables; }
+	std::size_t size() const { return terms.size(); }
+	unsigned getDegree() const;
+	// Largest exponent a single variable can hold.
+	unsigned maxExponent() const { return (1u << (bits - 1)) - 1; }
+
+	// Evaluate at point x, one value per variable.
+	T evaluate(const std::vector<T>& x) const;
+
+	// Add polynomials.
+	MultiPolynomial operator+ (const MultiPolynomial& rhs) const;
+	// Subtract polynomials.
+	MultiPolynomial operator- (const MultiPolynomial& rhs) const { return *this + (-rhs); }
+	// Multiply polynomials by heap merge.
+	MultiPolynomial operator* (const MultiPolynomial& rhs) const;
+	// Overloaded unary minus operator.
+	MultiPolynomial operator- () const
+	{
+		MultiPolynomial result = *this;
+
+		for (auto& t : result.terms)
+			t.second = -t.second;
+
+		return result;
+	}
+
+	MultiPolynomial& operator+= (const MultiPolynomial& rhs) { return *this = *this + rhs; }
+	MultiPolynomial& operator-= (const MultiPolynomial& rhs) { return *this = *this - rhs; }
+	MultiPolynomial& operator*= (const MultiPolynomial& rhs) { return *this = *this * rhs; }
+
+	// Overload equality operator.
+	bool operator== (const MultiPolynomial& rhs) const { return variables == rhs.variables && terms == rhs.terms; }
+	bool operator!= (const MultiPolynomial& rhs) const { return !(*this == rhs); }
+
+	// Stream polynomial, highest monomial first.
+	friend std::ostream& operator<< (std::ostream& os, const MultiPolynomial& p)
+	{
+		if (p.terms.empty())
+			return os << "0";
+
+		for (auto it = p.terms.crbegin(); it != p.terms.crend(); ++it)
+		{
+			if (it != p.terms.crbegin())
+				os << " + ";
+			os << it->second;
+			for (unsigned i = 0; i < p.variables; i++)
+			{
+				const unsigned e = p.exponent(it->first, i);
+				if (e)
+					os << "x" << i << "^" << e;
+			}
+		}
+
+		return os;
+	}
+};
+
+// Zero polynomial in given number of variables.
+template<typename T>
+MultiPolynomial<T>::MultiPolynomial(const unsigned variables) : variables(variables), bits(variables > 1 ? 64 / variables : 32), guards(0)
+{
+	if (variables < 1 || variables > 16)
+		throw std::domain_error("MultiPolynomial supports 1 to 16 variables");
+
+	for (unsigned i = 0; i < variables; i++)
+		guards |= std::uint64_t{ 1 } << (i * bits + bits - 1);
+}
+
+// From (exponents, coefficient) pairs.
+template<typename T>
+MultiPolynomial<T>::MultiPolynomial(const unsigned variables, std::initializer_list<std::pair<std::vector<unsigned>, T>> init) : MultiPolynomial(variables)
+{
+	for (auto& t : init)
+		setTerm(t.first, t.second);
+}
+
+// Variable x_i.
+template<typename T>
+MultiPolynomial<T> MultiPolynomial<T>::variable(const unsigned variables, const unsigned i)
+{
+	MultiPolynomial<T> result(variables);
+	std::vector<unsigned> exponents(variables, 0);
+
+	exponents.at(i) = 1;
+	result.setTerm(exponents, T{ 1 });
+
+	return result;
+}
+
+// Pack exponents into a monomial word, throws if one does not fit.
+template<typename T>
+std::uint64_t MultiPolynomial<T>::pack(const std::vector<unsigned>& exponents) const
+{
+	if (exponents.size() != variables)
+		throw std::domain_error("Exponent count does not match variables");
+
+	std::uint64_t monomial = 0;
+
+	for (unsigned i = 0; i < variables; i++)
+	{
+		if (exponents[i] > maxExponent())
+			throw std::overflow_error("Exponent overflow");
+		monomial = (monomial << bits) | exponents[i];
+	}
+
+	return monomial;
+}
+
+// Exponent of variable in monomial.
+template<typename T>
+unsigned MultiPolynomial<T>::exponent(const std::uint64_t monomial, const unsigned variable) const
+{
+	return static_cast<unsigned>((monomial >> ((variables - 1 - variable) * bits)) & ((std::uint64_t{ 1 } << bits) - 1));
+}
+
+// Product of two monomials, throws on exponent overflow.
+template<typename T>
+std::uint64_t MultiPolynomial<T>::multiply(const std::uint64_t a, const std::uint64_t b) const
+{
+	// Fields are below their guard bits, so the sum cannot carry across fields.
+	const std::uint64_t product = a + b;
+
+	if (product & guards)
+		throw std::overflow_error("Exponent overflow");
+
+	return product;
+}
+
+// Throw unless rhs has the same variables.
+template<typename T>
+void MultiPolynomial<T>::checkVariables(const MultiPolynomial<T>& rhs) const
+{
+	if (variables != rhs.variables)
+		throw std::domain_error("Polynomials in different variables");
+}
+
+// x^e by repeated squaring.
+template<typename T>
+T MultiPolynomial<T>::power(T x, unsigned e)
+{
+	T result{ 1 };
+
+	for (; e; e >>= 1)
+	{
+		if (e & 1)
+			result *= x;
+		if (e > 1)
+			x *= x;
+	}
+
+	return result;
+}
+
+// Univariate p in the chosen variable.
+template<typename T>
+MultiPolynomial<T> MultiPolynomial<T>::fromPolynomial(const Polynomial<T>& p, const unsigned variables, const unsigned variable)
+{
+	MultiPolynomial<T> result(variables);
+	std::vector<unsigned> exponents(variables, 0);
+
+	// Ascending exponents in one variable are ascending monomials.
+	for (auto& t : p)
+	{
+		if (t.second == T{ 0 })
+			continue;
+		exponents.at(variable) = t.first;
+		result.terms.emplace_back(result.pack(exponents), t.second);
+	}
+
+	return result;
+}
+
+// Convert to a univariate Polynomial, requires no other variable to appear.
+template<typename T>
+Polynomial<T> MultiPolynomial<T>::toPolynomial(const unsigned variable) const
+{
+	if (variable >= variables)
+		throw std::domain_error("No such variable");
+
+	// Bits of every field but the chosen variable's.
+	const std::uint64_t others = ~(((std::uint64_t{ 1 } << bits) - 1) << ((variables - 1 - variable) * bits));
+	Polynomial<T> result;
+
+	for (auto& t : terms)
+	{
+		if (t.first & others)
+			throw std::domain_error("Polynomial depends on other variables");
+		result.setTerm(exponent(t.first, variable), t.second);
+	}
+
+	return result;
+}
+
+// Convert to a univariate Polynomial, substituting point[j] for every other variable x_j.
+template<typename T>
+Polynomial<T> MultiPolynomial<T>::toPolynomial(const unsigned variable, const std::vector<T>& point) const
+{
+	if (variable >= variables)
+		throw std::domain_error("No such variable");
+	if (point.size() != variables)
+		throw std::domain_error("Point size does not match variables");
+
+	Polynomial<T> result;
+
+	for (auto& t : terms)
+	{
+		T coefficient = t.second;
+		for (unsigned j = 0; j < variables; j++)
+			if (j != variable)
+				coefficient *= power(point[j], exponent(t.first, j));
+		result.setTerm(exponent(t.first, variable), coefficient);
+	}
+
+	return result;
+}
+
+// Add coefficient to term with given exponents.
+template<typename T>
+void MultiPolynomial<T>::setTerm(const std::vector<unsigned>& exponents, const T coefficient)
+{
+	const std::uint64_t monomial = pack(exponents);
+	auto it = std::lower_bound(terms.begin(), terms.end(), monomial, [](const Term& t, const std::uint64_t m) { return t.first < m; });
+
+	if (it != terms.end() && it->first == monomial)
+	{
+		it->second += coefficient;
+		if (it->second == T{ 0 })
+			terms.erase(it);
+	}
+	else if (coefficient != T{ 0 })
+		terms.emplace(it, monomial, coefficient);
+}
+
+// Coefficient of term with given exponents, zero if absent.
+template<typename T>
+T MultiPolynomial<T>::getTerm(const std::vector<unsigned>& exponents) const
+{
+	const std::uint64_t monomial = pack(exponents);
+	auto it = std::lower_bound(terms.begin(), terms.end(), monomial, [](const Term& t, const std::uint64_t m) { return t.first < m; });
+
+	return (it != terms.end() && it->first == monomial) ? it->second : T{ 0 };
+}
+
+// Total degree, zero for the zero polynomial.
+template<typename T>
+unsigned MultiPolynomial<T>::getDegree() const
+{
+	unsigned degree = 0;
+
+	for (auto& t : terms)
+	{
+		unsigned d = 0;
+		for (unsigned i = 0; i < variables; i++)
+			d += exponent(t.first, i);
+		degree = std::max(degree, d);
+	}
+
+	return degree;
+}
+
+// Evaluate at point x, one value per variable.
+template<typename T>
+T MultiPolynomial<T>::evaluate(const std::vector<T>& x) const
+{
+	if (x.size() != variables)
+		throw std::domain_error("Point size does not match variables");
+
+	return terms.empty() ? T{ 0 } : evaluate(0, terms.size(), 0, x);
+}
+
+// Horner evaluation of terms [first, last), which agree below variable.
+//
+// In monomial order such terms come grouped by their exponent of this
+// variable, ascending. Each group is the coefficient of one power,
+// evaluated recursively in the remaining variables.
+template<typename T>
+T MultiPolynomial<T>::evaluate(std::size_t first, const std::size_t last, const unsigned variable, const std::vector<T>& x) const
+{
+	if (variable == variables)
+		return terms[first].second;
+
+	T result{ 0 };
+	unsigned previous = exponent(terms[last - 1].first, variable);
+
+	// Groups from the highest power down.
+	for (std::size_t end = last; end > first; )
+	{
+		const unsigned e = exponent(terms[end - 1].first, variable);
+		std::size_t begin = end - 1;
+		while (begin > first && exponent(terms[begin - 1].first, variable) == e)
+			begin--;
+
+		result = result * power(x[variable], previous - e) + evaluate(begin, end, variable + 1, x);
+		previous = e;
+		end = begin;
+	}
+
+	return result * power(x[variable], previous);
+}
+
+// Add polynomials.
+template<typename T>
+MultiPolynomial<T> MultiPolynomial<T>::operator+ (const MultiPolynomial<T>& rhs) const
+{
+	checkVariables(rhs);
+
+	MultiPolynomial<T> result(variables);
+	result.terms.reserve(terms.size() + rhs.terms.size());
+
+	// Merge sorted term lists.
+	std::size_t i = 0, j = 0;
+	while (i < terms.size() || j < rhs.terms.size())
+	{
+		if (j == rhs.terms.size() || (i < terms.size() && terms[i].first < rhs.terms[j].first))
+			result.terms.push_back(terms[i++]);
+		else if (i == terms.size() || rhs.terms[j].first < terms[i].first)
+			result.terms.push_back(rhs.terms[j++]);
+		else
+		{
+			const T sum = terms[i].second + rhs.terms[j].second;
+			if (sum != T{ 0 })
+				result.terms.emplace_back(terms[i].first, sum);
+			i++;
+			j++;
+		}
+	}
+
+	return result;
+}
+
+// Multiply polynomials by heap merge.
+//
+// One stream per term of the shorter operand (that term times every term
+// of the longer), merged through a min-heap on the packed monomial. Equal
+// monomials leave the heap together and are summed, so product terms are
+// appended in order without searching.
+template<typename T>
+MultiPolynomial<T> MultiPolynomial<T>::operator* (const MultiPolynomial<T>& rhs) const
+{
+	checkVariables(rhs);
+
+	MultiPolynomial<T> result(variables);
+	if (terms.empty() || rhs.terms.empty())
+		return result;
+
+	const std::vector<Term>& shorter = (terms.size() <= rhs.terms.size()) ? terms : rhs.terms;
+	const std::vector<Term>& longer = (terms.size() <= rhs.terms.size()) ? rhs.terms : terms;
+
+	// Stream i is shorter[i] times longer[column[i]].
+	std::vector<std::size_t> column(shorter.size(), 0);
+	// Heap of (monomial, stream) with the smallest monomial on top.
+	std::vector<std::pair<std::uint64_t, std::size_t>> heap;
+	auto later = [](const std::pair<std::uint64_t, std::size_t>& x, const std::pair<std::uint64_t, std::size_t>& y) { return x.first > y.first; };
+
+	heap.reserve(shorter.size());
+	for (std::size_t i = 0; i < shorter.size(); i++)
+		heap.emplace_back(multiply(shorter[i].first, longer[0].first), i);
+	std::make_heap(heap.begin(), heap.end(), later);
+
+	while (!heap.empty())
+	{
+		const std::uint64_t monomial = heap.front().first;
+		T sum{ 0 };
+
+		// Pop every stream head with this monomial, advancing each stream.
+		while (!heap.empty() && heap.front().first == monomial)
+		{
+			std::pop_heap(heap.begin(), heap.end(), later);
+			const std::size_t i = heap.back().second;
+			heap.pop_back();
+
+			sum += shorter[i].second * longer[column[i]].second;
+
+			if (++column[i] != longer.size())
+			{
+				heap.emplace_back(multiply(shorter[i].first, longer[column[i]].first), i);
+				std::push_heap(heap.begin(), heap.end(), later);
+			}
+		}
+
+		if (sum != T{ 0 })
+			result.terms.emplace_back(monomial, sum);
+	}
+
+	return result;
+}
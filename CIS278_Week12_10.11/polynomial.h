@@ -7,7 +7,7 @@
 * Exercise 10.11 on page 495-496, Polynomial Class
 *
 * Develop class Polynomial. The internal representation of a Polynomial is
-* an array of terms. Each term contains a coefficient and an exponente.g.,
+* an array of terms. Each term contains a coefficient and an exponent�e.g.,
 * the term:
 *   2x^4
 * Has the coefficient 2 and the exponent 4. Develop a complete class
@@ -35,32 +35,123 @@
 *               Changed return value from getDegree() to unsigned. JME
 *   04/12/2018: Added boost test file. JME
 *   06/03/2018: Changed to templated class. JME
+*   10/19/2026: Added Karatsuba multiplication of dense operands, with
+*               public toDense, fromDense and denseMultiply. JME
+*               Added heap merge multiplication of sparse operands. JME
+*               Added term iteration, compose and taylorShift. JME
+*               Added tabulate by forward differences. JME
+*               Made read functions const-correct, with copy-on-write
+*               term storage. JME
+*               Added cached fingerprint and std::hash specialization. JME
+*               Added DenseProduct hook for coefficient types with a
+*               faster array product. JME
+*               Added compensated Horner evaluateAccurate. JME
 *************************************************************************/
+#pragma once
+
 #include <string>    // string
 #include <iomanip>   // setprecision
 #include <sstream>   // stringstream
 #include <map>       // map for poly terms.
-#include <numeric>   // accumulate
+#include <memory>    // shared_ptr for copy-on-write terms
+#include <atomic>    // cached fingerprint
+#include <cstdint>   // uint64_t
+#include <functional> // hash
 #include <algorithm> // for_each
+#include <cmath>     // pow, sqrt, fma
+#include <vector>    // dense coefficient buffers
+#include <iterator>  // prev
+#include <thread>    // tabulate workers
 #include <initializer_list>
+#include <type_traits> // DenseProduct, HashableCoefficient
+#include <utility>   // declval
+#include <limits>    // epsilon
 
 #include "range_for_reverse_iterator.h"
 
+// Coefficient types with a faster product of whole coefficient arrays
+// specialize this as std::true_type, with a static member
+//   std::vector<T> multiply(const std::vector<T>& a, const std::vector<T>& b);
+// which dense multiplication then uses in place of Karatsuba.
+template<typename T>
+struct DenseProduct : std::false_type { };
+
+// Coefficient types with a usable std::hash, which fingerprint needs.
+// Others (std::complex, user field types) work everywhere else.
+template<typename T, typename = void>
+struct HashableCoefficient : std::false_type { };
+
+template<typename T>
+struct HashableCoefficient<T, decltype(void(std::hash<T>{}(std::declval<const T&>())))> : std::true_type { };
+
 template<typename T>
 class Polynomial
 {
 private:
-	// Polynomial terms contained in map in format of map<exponent, coefficient>.
-	std::map<unsigned, T> terms;
+	// Term storage with its cached fingerprint.
+	struct Storage
+	{
+		// Polynomial terms contained in map in format of map<exponent, coefficient>.
+		std::map<unsigned, T> terms;
+		// Fingerprint of the terms, valid when hashed is set. Concurrent readers
+		// may both compute it, but always store the same value.
+		mutable std::atomic<bool> hashed{ false };
+		mutable std::atomic<std::uint64_t> fingerprint{ 0 };
+		// Set once a writable reference to a coefficient has been handed out.
+		// Such storage is never shared (copies clone it) and its fingerprint
+		// is never cached, since writes through the reference bypass both.
+		bool unshareable = false;
+
+		Storage() = default;
+		Storage(const std::map<unsigned, T>& t) : terms(t) { }
+		Storage(std::map<unsigned, T>&& t) : terms(std::move(t)) { }
+		// Copies are shareable again.
+		Storage(const Storage& s) : terms(s.terms), hashed(s.hashed.load()), fingerprint(s.fingerprint.load()) { }
+	};
+
+	// Share rhs terms, or clone them if they cannot be shared.
+	static std::shared_ptr<Storage> share(const std::shared_ptr<Storage>& rhs)
+	{
+		return (rhs && rhs->unshareable) ? std::make_shared<Storage>(*rhs) : rhs;
+	}
+
+	// Terms, shared between copies until one of them is modified
+	// (copy-on-write). A null pointer is the zero polynomial.
+	//
+	// Whether to clone is decided from the advisory use_count, so a write
+	// needs exclusive access to every polynomial sharing these terms (the
+	// one it was copied from, and its copies), not just to its own object.
+	std::shared_ptr<Storage> shared;
+
+	// Read-only terms, safe for any number of concurrent readers.
+	const std::map<unsigned, T>& terms() const;
+	// Writable storage, cloned first if shared with another copy.
+	Storage& storage();
+	// Writable terms, for arbitrary changes that drop the cached fingerprint.
+	std::map<unsigned, T>& mutableTerms();
+
+	// Fingerprint contribution of one term, zero for null terms.
+	static std::uint64_t termHash(const unsigned exponent, const T& coefficient);
+
+	// Remove null terms.
+	void normalize();
 
 	// Determines if a term exists for given exponent.
 	bool exists(const unsigned& exponent) const;
 
 	// Absolute value.
-	T _abs(T);
+	static T _abs(T);
+
+	// Operand size below which schoolbook multiplication beats Karatsuba.
+	static const std::size_t karatsubaCutoff = 32;
+
+	// Determines if terms are dense enough to multiply as coefficient arrays.
+	bool isDense() const;
+	// Karatsuba product of two n-term arrays into 2n - 1 term output.
+	static void karatsuba(const T* a, const T* b, const std::size_t n, T* product);
 
 	// Overload greater than operator, used for polynomial division.
-	const bool operator> (Polynomial rhs)
+	const bool operator> (const Polynomial& rhs) const
 	{
 		if (_abs(evaluate(1)) > _abs(rhs.evaluate(1)))
 			return true;
@@ -73,20 +164,48 @@ public:
 	Polynomial();
 	// List initaializer constructor.
 	Polynomial(std::initializer_list<std::pair<const unsigned, T> > init);
+	// Copy constructor, shares terms with p.
+	Polynomial(const Polynomial& p) : shared(share(p.shared)) { }
 	// Default destructor.
 	~Polynomial() = default;
 
 	// Setter function for term.
 	void setTerm(const unsigned exponent, const T coefficient);
 	// Getter function for term coefficient.
-	bool const getTerm(const unsigned exponent, T& coefficient);
+	bool const getTerm(const unsigned exponent, T& coefficient) const;
 	// Getter function for polynomial degree.
-	unsigned const getDegree();
+	unsigned const getDegree() const;
 
 	// Evaluate polynomial at x.
-	T evaluate(T x);
+	T evaluate(T x) const;
+	// Evaluate floating point polynomial at x by compensated Horner, with optional error bound.
+	T evaluateAccurate(const T x, T* errorBound = nullptr) const;
+	// Evaluate at x[i] into y[i] for i < count by compensated Horner, with optional error bounds.
+	void evaluateAccurate(const T* x, T* y, const std::size_t count, T* errorBounds = nullptr) const;
 	// Differentiate polynomial and return result.
-	Polynomial differentiate();
+	Polynomial differentiate() const;
+
+	// Tabulate p(x0 + i h) for i < count into out[i] by forward differences.
+	template<typename RandomIt>
+	void tabulate(const T x0, const T h, const std::size_t count, RandomIt out, const std::size_t reseed = 0, unsigned threads = 1) const;
+
+	// 64-bit fingerprint of the non-null terms, equal for equal polynomials.
+	std::uint64_t fingerprint() const;
+
+	// Copy terms into a dense coefficient array indexed by exponent.
+	std::vector<T> toDense() const;
+	// Build polynomial from a dense coefficient array, dropping zero terms.
+	static Polynomial fromDense(const std::vector<T>& coefficients);
+	// Multiply two dense coefficient arrays.
+	static std::vector<T> denseMultiply(const std::vector<T>& a, const std::vector<T>& b);
+
+	// Stream product terms to sink(exponent, coefficient) in ascending exponent order.
+	template<typename Sink>
+	static void multiplyTerms(const Polynomial& a, const Polynomial& b, Sink sink);
+
+	// Iterate terms as (exponent, coefficient) pairs in ascending exponent order.
+	typename std::map<unsigned, T>::const_iterator begin() const { return terms().cbegin(); }
+	typename std::map<unsigned, T>::const_iterator end() const { return terms().cend(); }
 
 	// Return polynomial coefficient at exponent index.
 	T operator[] (const int exponent) const
@@ -94,152 +213,163 @@ public:
 		if (exponent < 0)
 			throw std::out_of_range("Index < 0");
 	
-		return terms.at(exponent);
+		return terms().at(exponent);
 	}
 
-	// Set polynomial coefficient at exponent index.
+	// Set polynomial coefficient at exponent index. The reference stays
+	// valid while the term exists, so these terms are no longer shared.
 	T& operator[] (const int exponent)  
 	{
 		if (exponent < 0)
 			throw std::out_of_range("Index < 0");
 		
-		return terms[exponent];
+		std::map<unsigned, T>& t = mutableTerms();
+		shared->unshareable = true;
+
+		return t[exponent];
 	}
 
-	// Overload assignment operator.
-	const Polynomial& operator= (const Polynomial rhs)
+	// Overload assignment operator, shares rhs terms.
+	const Polynomial& operator= (const Polynomial& rhs)
 	{
-		// Check for self-assignment.
-		if (this == &rhs)
-			// Skip assignment, and just return *this.
-			return *this;
-
-		// Zeroize poly, and reassign this to rhs terms.
-		terms.clear();
-
-		for (auto t : rhs.terms)
-			terms[t.first] = t.second;
+		// Self-assignment is harmless, the pointer is copied onto itself.
+		if (shared != rhs.shared)
+			shared = share(rhs.shared);
 
 		return *this;
 	}
 
 	// Add polynomials via overloaded binary plus operator.
-	const Polynomial operator+ (const Polynomial rhs)
+	const Polynomial operator+ (const Polynomial& rhs) const
 	{
-		// Copy this's terms to result poly.
-		Polynomial result = *this;
+		// Copy this's terms once, add the rhs terms, and move them into result.
+		std::map<unsigned, T> sum = terms();
+		for (auto& t : rhs.terms())
+			sum[t.first] += t.second;
 
-		// Use accumulator to add rhs to lhs terms. 
-		result.terms = accumulate(rhs.terms.cbegin(), rhs.terms.cend(), result.terms,
-			[](std::map<unsigned, T>& t, const std::pair<const unsigned, T>& p)
-			{ 
-				return (t[p.first] += p.second, t); 
-			}
-		);
+		Polynomial result;
+		result.shared = std::make_shared<Storage>(std::move(sum));
 
 		// Normalize polynomial.
-		result.getDegree();
+		result.normalize();
 
 		return result;
 	}
 
 	// Subtract polynomials via overloaded binary minus operator.
-	const Polynomial operator- (const Polynomial rhs)
+	const Polynomial operator- (const Polynomial& rhs) const
 	{
-		// Copy this's terms to result poly.
-		Polynomial result = *this;
+		// Copy this's terms once, subtract the rhs terms, and move them into result.
+		std::map<unsigned, T> sum = terms();
+		for (auto& t : rhs.terms())
+			sum[t.first] -= t.second;
 
-		// Use accumulator to subtract rhs from lhs terms. 
-		result.terms = accumulate(rhs.terms.cbegin(), rhs.terms.cend(), result.terms,
-			[](std::map<unsigned, T> &t, const std::pair<const unsigned, T> &p)
-			{ 
-				return (t[p.first] -= p.second, t); 
-			}
-		);
+		Polynomial result;
+		result.shared = std::make_shared<Storage>(std::move(sum));
 
 		// Normalize polynomial.
-		result.getDegree();
+		result.normalize();
 
 		return result;
 	}
 
 	// Multiply Polynomials via overloaded binary multiplication operator.
-	const Polynomial operator* (const Polynomial rhs)
+	const Polynomial operator* (const Polynomial& rhs) const
 	{
+		// Dense operands are multiplied as coefficient arrays.
+		if (isDense() && rhs.isDense())
+			return fromDense(denseMultiply(toDense(), rhs.toDense()));
+
 		Polynomial result;
 
-		// Multiply all lhs (or this) terms by all rhs terms.
-		for_each(this->terms.cbegin(), this->terms.cend(), [&result, rhs](auto lhsTerm) 
+		// Sparse product terms arrive in exponent order, so each is appended at the end.
+		std::map<unsigned, T>& product = result.mutableTerms();
+		multiplyTerms(*this, rhs, [&product](const unsigned exponent, const T& coefficient)
 		{
-			for_each(rhs.terms.cbegin(), rhs.terms.cend(), [&result, lhsTerm](auto rhsTerm) 
-			{
-				result.terms[lhsTerm.first + rhsTerm.first] += (lhsTerm.second * rhsTerm.second);
-			} );
+			product.emplace_hint(product.end(), exponent, coefficient);
 		} );
 
-		// Normalize polynomial.
-		result.getDegree();
-
 		return result;
 	}
 
 	// Overloaded unary += operator, passes our to "overloaded +".
-	const Polynomial& operator+= (const Polynomial rhs)
+	const Polynomial& operator+= (const Polynomial& rhs)
 	{
 		*this = *this + rhs;
 		return *this;
 	}
 
 	// Overloaded unary -= operator, passes our to "overloaded -".
-	const Polynomial& operator-= (const Polynomial rhs)
+	const Polynomial& operator-= (const Polynomial& rhs)
 	{
 		*this = *this - rhs;
 		return *this;
 	}
 
 	// Overloaded unary *= operator, passes to our "overloaded *".
-	const Polynomial& operator*= (const Polynomial rhs)
+	const Polynomial& operator*= (const Polynomial& rhs)
 	{
 		*this = *this * rhs;
 		return *this;
 	}
 
-	// Overloaded unary minus operator.
-	const Polynomial operator- ()
+	// Overloaded unary minus operator, returns negated copy.
+	const Polynomial operator- () const
 	{
+		Polynomial result = *this;
+
 		// Iterate through all terms negating them.
-		for (auto& t : (*this).terms)
+		for (auto& t : result.mutableTerms())
 			t.second = -t.second;
 
-		return *this;
+		return result;
 	}
 
 	// Overload equality operator.
-	const bool operator== (Polynomial rhs)
+	const bool operator== (const Polynomial& rhs) const
 	{
-		if ((*this).getDegree() != rhs.getDegree())
+		// Shared terms are equal.
+		if (shared == rhs.shared)
+			return true;
+
+		// Differing cached fingerprints reject in constant time.
+		if (shared && rhs.shared && shared->hashed.load(std::memory_order_acquire) && rhs.shared->hashed.load(std::memory_order_acquire)
+			&& shared->fingerprint.load(std::memory_order_relaxed) != rhs.shared->fingerprint.load(std::memory_order_relaxed))
 			return false;
 
-		// Iterate through all terms, check equal.
-		for (auto& t : (*this).terms)
-			// If coefficients don't match then fail.
-			if (rhs[t.first] != t.second)
+		// Walk both term lists in step, skipping null terms.
+		auto lhsTerm = terms().cbegin(), rhsTerm = rhs.terms().cbegin();
+
+		for (;;)
+		{
+			while (lhsTerm != terms().cend() && lhsTerm->second == T{ 0 })
+				++lhsTerm;
+			while (rhsTerm != rhs.terms().cend() && rhsTerm->second == T{ 0 })
+				++rhsTerm;
+
+			if (lhsTerm == terms().cend() || rhsTerm == rhs.terms().cend())
+				return lhsTerm == terms().cend() && rhsTerm == rhs.terms().cend();
+
+			// If exponents or coefficients don't match then fail.
+			if (lhsTerm->first != rhsTerm->first || lhsTerm->second != rhsTerm->second)
 				return false;
 
-		return true;
+			++lhsTerm;
+			++rhsTerm;
+		}
 	}
 
 	// Overload inequality operator.
-	const bool operator!= (Polynomial rhs)
+	const bool operator!= (const Polynomial& rhs) const
 	{
 		return !(*this == rhs);
 	}
 
 	// Divide polynomials via overloaded binary modulus operator.
-	const Polynomial operator% (Polynomial& divisor)
+	const Polynomial operator% (const Polynomial& divisor) const
 	{
 		// Check for division by zero.
-		if (divisor.getDegree() == 0 && divisor[0] == T{ 0 })
+		if (divisor.getDegree() == 0 && (!divisor.exists(0) || divisor[0] == T{ 0 }))
 			throw std::overflow_error("Divide by zero");
 
 		// Preserve this.
@@ -252,10 +382,16 @@ public:
 
 		Polynomial quotient;
 
+		// Lead terms are read through getTerm, so neither operand's storage is unshared.
+		T divisorLead{ 0 };
+		divisor.getTerm(divisor.getDegree(), divisorLead);
+
 		// Iterate through all dividend terms.
 		do {
 			// Divide coefficients of highest terms, subtract exponents, insert as new quotient term.
-			quotient[dividend.getDegree() - divisor.getDegree()] = dividend[dividend.getDegree()] / divisor[divisor.getDegree()];
+			T lead{ 0 };
+			dividend.getTerm(dividend.getDegree(), lead);
+			quotient.setTerm(dividend.getDegree() - divisor.getDegree(), lead / divisorLead);
 
 			// Multiply divisor by quotient and subtract from dividend.
 			dividend = *this - (divisor * quotient);
@@ -264,16 +400,16 @@ public:
 		} while ((dividend.getDegree() != 0) && (dividend.getDegree() >= divisor.getDegree()));
 
 		// Normalize polynomial.
-		dividend.getDegree();
+		dividend.normalize();
 
 		return dividend;
 	}
 	
 	// Polynomial long division via overloaded binary divide operator.
-	const Polynomial operator/ (Polynomial& divisor)
+	const Polynomial operator/ (const Polynomial& divisor) const
 	{
 		// Check for division by zero.
-		if (divisor.getDegree() == 0 && divisor[0] == T{ 0 })
+		if (divisor.getDegree() == 0 && (!divisor.exists(0) || divisor[0] == T{ 0 }))
 			throw std::overflow_error("Divide by zero");
 
 		// Preserve this.
@@ -286,10 +422,16 @@ public:
 
 		Polynomial quotient;
 
+		// Lead terms are read through getTerm, so neither operand's storage is unshared.
+		T divisorLead{ 0 };
+		divisor.getTerm(divisor.getDegree(), divisorLead);
+
 		// Iterate through all dividend terms.
 		do {
 			// Divide coefficients of highest terms, subtract exponents, insert as new quotient term.
-			quotient[dividend.getDegree() - divisor.getDegree()] = dividend[dividend.getDegree()] / divisor[divisor.getDegree()];
+			T lead{ 0 };
+			dividend.getTerm(dividend.getDegree(), lead);
+			quotient.setTerm(dividend.getDegree() - divisor.getDegree(), lead / divisorLead);
 
 			// Multiply divisor by quotient and subtract from dividend.
 			dividend = *this - (divisor * quotient);
@@ -298,13 +440,13 @@ public:
 		} while ((dividend.getDegree() != 0) && (dividend.getDegree() >= divisor.getDegree()));
 
 		// Normalize polynomial.
-		quotient.getDegree();
+		quotient.normalize();
 
 		return quotient;
 	}
 
 	// Overloaded unary /= operator, passes to our "overloaded /".
-	const Polynomial& operator/= (Polynomial rhs)
+	const Polynomial& operator/= (const Polynomial& rhs)
 	{
 		*this = *this / rhs;
 		return *this;
@@ -317,12 +459,12 @@ public:
 		std::string s{ "" };
 
 		// Check for zero polynomial first.
-		if (p.terms.empty())
+		if (p.terms().empty())
 			s = "0";
 		else
 		{
 			// Iterate backwards through all terms.
-			for (auto& t : reverse(p.terms))
+			for (auto& t : reverse(p.terms()))
 			{
 				// Only terms with coefficients are printed.
 				if (t.second)
@@ -330,7 +472,7 @@ public:
 					std::stringstream stream;
 
 					// Print/format properly leading sign.
-					s += (t == *p.terms.rbegin()) ? (t.second < T{ 0 }) ? "-" : "" : (t.second > T{ 0 }) ? " + " : " - ";
+					s += (t == *p.terms().rbegin()) ? (t.second < T{ 0 }) ? "-" : "" : (t.second > T{ 0 }) ? " + " : " - ";
 					stream << std::fixed << std::setprecision(1) << abs(t.second);
 					// Skip display of superfluous 0 exponent.
 					if (t.first)
@@ -349,19 +491,117 @@ public:
 template<typename T>
 Polynomial<T>::Polynomial()
 {
-	// Empty polynomial.
-	terms.clear();
+	// Empty polynomial, no terms allocated.
 }
 
 // List initaializer constructor.
 template<typename T>
-Polynomial<T>::Polynomial(std::initializer_list<std::pair<const unsigned, T> > init) : terms(init) { }
+Polynomial<T>::Polynomial(std::initializer_list<std::pair<const unsigned, T> > init) : shared(std::make_shared<Storage>(init)) { }
+
+// Read-only terms, safe for any number of concurrent readers.
+template<typename T>
+const std::map<unsigned, T>& Polynomial<T>::terms() const
+{
+	// Shared by every zero polynomial, initialized once thread-safely.
+	static const std::map<unsigned, T> none;
+
+	return shared ? shared->terms : none;
+}
+
+// Writable storage, cloned first if shared with another copy.
+//
+// use_count is not synchronized with other threads: one that copies or
+// releases a sharing polynomial at the same time may be missed, and then
+// see this write. Callers keep such threads out while writing.
+template<typename T>
+typename Polynomial<T>::Storage& Polynomial<T>::storage()
+{
+	if (!shared)
+		shared = std::make_shared<Storage>();
+	else if (shared.use_count() > 1)
+		shared = std::make_shared<Storage>(*shared);
+
+	return *shared;
+}
+
+// Writable terms, for arbitrary changes that drop the cached fingerprint.
+template<typename T>
+std::map<unsigned, T>& Polynomial<T>::mutableTerms()
+{
+	Storage& s = storage();
+	s.hashed.store(false, std::memory_order_relaxed);
+
+	return s.terms;
+}
+
+// Fingerprint contribution of one term, zero for null terms.
+template<typename T>
+std::uint64_t Polynomial<T>::termHash(const unsigned exponent, const T& coefficient)
+{
+	if (coefficient == T{ 0 })
+		return 0;
+
+	// splitmix64 finalizer over exponent and coefficient hash.
+	std::uint64_t x = static_cast<std::uint64_t>(std::hash<T>{}(coefficient)) ^ (std::uint64_t{ exponent } * 0x9E3779B97F4A7C15ull);
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+
+	return x ^ (x >> 31);
+}
+
+// 64-bit fingerprint of the non-null terms, equal for equal polynomials.
+//
+// The fingerprint is the wrapping sum of independent term hashes, so
+// setTerm updates it in constant time. Other changes drop it, and it is
+// recomputed on the next call.
+template<typename T>
+std::uint64_t Polynomial<T>::fingerprint() const
+{
+	if (!shared)
+		return 0;
+
+	if (shared->hashed.load(std::memory_order_acquire))
+		return shared->fingerprint.load(std::memory_order_relaxed);
+
+	std::uint64_t sum = 0;
+	for (auto& t : shared->terms)
+		sum += termHash(t.first, t.second);
+
+	// Coefficients may change through a handed out reference.
+	if (shared->unshareable)
+		return sum;
+
+	shared->fingerprint.store(sum, std::memory_order_relaxed);
+	shared->hashed.store(true, std::memory_order_release);
+
+	return sum;
+}
+
+// Remove null terms.
+template<typename T>
+void Polynomial<T>::normalize()
+{
+	// Leave shared terms alone unless there is something to remove.
+	if (std::none_of(terms().cbegin(), terms().cend(), [](const std::pair<const unsigned, T>& t) { return t.second == T{ 0 }; }))
+		return;
+
+	// Null terms do not contribute to the fingerprint, so it stays valid.
+	std::map<unsigned, T>& t = storage().terms;
+
+	for (auto it = t.begin(); it != t.end(); )
+	{
+		if ((*it).second == T{ 0 })
+			it = t.erase(it);
+		else
+			++it;
+	}
+}
 
 // Determines if a term exists for exponent.
 template<typename T>
 bool Polynomial<T>::exists(const unsigned& exponent) const
 {
-	return terms.count(exponent);
+	return terms().count(exponent);
 }
 
 // Setter function for term.
@@ -369,18 +609,38 @@ template<typename T>
 void Polynomial<T>::setTerm(const unsigned exponent, const T coefficient)
 {
 	// Set or update an existing polynomial term.
-	if (coefficient != T{ 0 })
-		terms[exponent] += coefficient;
+	if (coefficient == T{ 0 })
+		return;
+
+	Storage& s = storage();
+	T& term = s.terms[exponent];
+
+	// Swap this term's contribution in a still valid fingerprint. A valid
+	// fingerprint means fingerprint() was called, so T is hashable.
+	if constexpr (HashableCoefficient<T>::value)
+	{
+		if (s.hashed.load(std::memory_order_relaxed))
+		{
+			const std::uint64_t before = termHash(exponent, term);
+			term += coefficient;
+			s.fingerprint.store(s.fingerprint.load(std::memory_order_relaxed) - before + termHash(exponent, term), std::memory_order_relaxed);
+			return;
+		}
+	}
+
+	term += coefficient;
 }
 
 // Getter function for term coefficient.
 template<typename T>
-bool const Polynomial<T>::getTerm(const unsigned exponent, T& coefficient)
+bool const Polynomial<T>::getTerm(const unsigned exponent, T& coefficient) const
 {
 	// Get polynomial term if exists.
-	if (exists(exponent))
+	auto it = terms().find(exponent);
+
+	if (it != terms().cend())
 	{
-		coefficient = terms[exponent];
+		coefficient = it->second;
 		return true;
 	}
 
@@ -389,53 +649,114 @@ bool const Polynomial<T>::getTerm(const unsigned exponent, T& coefficient)
 
 // Getter function for polynomial degree.
 template<typename T>
-unsigned const Polynomial<T>::getDegree()
+unsigned const Polynomial<T>::getDegree() const
 {
-	// Check for and remove any null terms.
-	auto it = terms.begin();
+	// Return highest degree with a non-null term, or zero.
+	for (auto it = terms().crbegin(); it != terms().crend(); ++it)
+		if (it->second != T{ 0 })
+			return it->first;
 
-	while (it != terms.end())
-	{
-		if ((*it).second == T{ 0 })
-			it = terms.erase(it);
-		else
-			++it;
-	}
-
-	// Return highest degree or zero.
-	if (!terms.empty())
-		return terms.rbegin()->first;
-	else
-		return 0;
+	return 0;
 }
 
 // Evaluate polynomial at x.
 template<typename T>
-T Polynomial<T>::evaluate(T x)
+T Polynomial<T>::evaluate(T x) const
 {
 	T p{ 0 };
 
-	for (auto t : terms)
+	for (auto& t : terms())
 		p += (pow(x, t.first) * t.second);
 
 	return p;
 }
 
+// Evaluate floating point polynomial at x by compensated Horner, with optional error bound.
+//
+// Each Horner step s x + a is split into its rounded value and exact
+// rounding errors by error-free transforms (TwoProd via fma, TwoSum). The
+// errors are summed by a second Horner pass and added back at the end,
+// so the result is as accurate as Horner in twice the working precision.
+// The bound on |result - p(x)| is Langlois and Louvet's a posteriori one:
+//   (u |r| + (gamma(4n + 2) b + 2 u^2 |r|)) / (1 - 2u),
+// where b is the Horner sum of the error magnitudes at |x|.
+template<typename T>
+T Polynomial<T>::evaluateAccurate(const T x, T* errorBound) const
+{
+	T y;
+	evaluateAccurate(&x, &y, 1, errorBound);
+
+	return y;
+}
+
+// Evaluate at x[i] into y[i] for i < count by compensated Horner, with optional error bounds.
+//
+// The coefficient loop is outside and the point loop inside, a straight
+// line of fma, add and multiply over contiguous arrays the compiler can
+// vectorize.
+template<typename T>
+void Polynomial<T>::evaluateAccurate(const T* x, T* y, const std::size_t count, T* errorBounds) const
+{
+	static_assert(std::is_floating_point<T>::value, "evaluateAccurate requires floating point coefficients");
+
+	const std::vector<T> a = toDense();
+
+	if (a.empty())
+	{
+		std::fill(y, y + count, T{ 0 });
+		if (errorBounds)
+			std::fill(errorBounds, errorBounds + count, T{ 0 });
+		return;
+	}
+
+	// Horner value, correction, and correction magnitude per point.
+	std::vector<T> s(count, a.back()), c(count, T{ 0 }), b(count, T{ 0 });
+
+	for (std::size_t k = a.size() - 1; k-- > 0; )
+	{
+		const T coefficient = a[k];
+
+		for (std::size_t i = 0; i < count; i++)
+		{
+			// TwoProd: p + pi = s x exactly.
+			const T p = s[i] * x[i];
+			const T pi = std::fma(s[i], x[i], -p);
+
+			// TwoSum: s' + sigma = p + a_k exactly.
+			const T sum = p + coefficient;
+			const T z = sum - p;
+			const T sigma = (p - (sum - z)) + (coefficient - z);
+
+			s[i] = sum;
+			c[i] = c[i] * x[i] + (pi + sigma);
+			b[i] = b[i] * std::abs(x[i]) + (std::abs(pi) + std::abs(sigma));
+		}
+	}
+
+	for (std::size_t i = 0; i < count; i++)
+		y[i] = s[i] + c[i];
+
+	if (errorBounds)
+	{
+		const T u = std::numeric_limits<T>::epsilon() / 2;
+		const T n = T(a.size() - 1);
+		const T gamma = (4 * n + 2) * u / (1 - (4 * n + 2) * u);
+
+		for (std::size_t i = 0; i < count; i++)
+			errorBounds[i] = (u * std::abs(y[i]) + (gamma * b[i] + 2 * u * u * std::abs(y[i]))) / (1 - 2 * u);
+	}
+}
+
 // Differentiate polynomial and return result.
 template<typename T>
-Polynomial<T> Polynomial<T>::differentiate()
+Polynomial<T> Polynomial<T>::differentiate() const
 {
 	Polynomial<T> derivative;
-	unsigned degree = getDegree();
 
-	if (degree == 0)
-		return derivative;
-
-	//derivative.degree = degree - 1;
-	// Calculate by looping through all terms.
-	for (unsigned i = 0; i < degree; i++)
-		if (exists(i + 1))
-			derivative.terms[i] = (i + 1) * terms[i + 1];
+	// Calculate by looping through all terms, exponent zero drops out.
+	for (auto& t : terms())
+		if (t.first != 0 && t.second != T{ 0 })
+			derivative.mutableTerms().emplace_hint(derivative.mutableTerms().end(), t.first - 1, T(t.first) * t.second);
 
 	return derivative;
 }
@@ -448,3 +769,397 @@ T Polynomial<T>::_abs(T x)
 	else
 		return x;
 }
+
+// Determines if terms are dense enough to multiply as coefficient arrays.
+template<typename T>
+bool Polynomial<T>::isDense() const
+{
+	// Require enough terms to amortize the array (any two for a DenseProduct
+	// type) and at least half filled.
+	if (terms().size() < (DenseProduct<T>::value ? 2 : karatsubaCutoff))
+		return false;
+
+	return 2 * terms().size() > terms().rbegin()->first + std::size_t{ 1 };
+}
+
+// Copy terms into a dense coefficient array indexed by exponent.
+template<typename T>
+std::vector<T> Polynomial<T>::toDense() const
+{
+	if (terms().empty())
+		return std::vector<T>();
+
+	std::vector<T> coefficients(terms().rbegin()->first + std::size_t{ 1 }, T{ 0 });
+
+	for (auto& t : terms())
+		coefficients[t.first] = t.second;
+
+	return coefficients;
+}
+
+// Build polynomial from a dense coefficient array, dropping zero terms.
+template<typename T>
+Polynomial<T> Polynomial<T>::fromDense(const std::vector<T>& coefficients)
+{
+	Polynomial<T> result;
+	std::map<unsigned, T>& resultTerms = result.mutableTerms();
+
+	// Exponents arrive in order, so each insert is appended at the end.
+	for (std::size_t i = 0; i < coefficients.size(); i++)
+		if (coefficients[i] != T{ 0 })
+			resultTerms.emplace_hint(resultTerms.end(), static_cast<unsigned>(i), coefficients[i]);
+
+	return result;
+}
+
+// Multiply two dense coefficient arrays.
+template<typename T>
+std::vector<T> Polynomial<T>::denseMultiply(const std::vector<T>& a, const std::vector<T>& b)
+{
+	if (a.empty() || b.empty())
+		return std::vector<T>();
+
+	if constexpr (DenseProduct<T>::value)
+		return DenseProduct<T>::multiply(a, b);
+
+	// Split the longer operand into chunks the size of the shorter one.
+	const std::vector<T>& shorter = (a.size() < b.size()) ? a : b;
+	const std::vector<T>& longer = (a.size() < b.size()) ? b : a;
+	const std::size_t n = shorter.size();
+
+	std::vector<T> result(a.size() + b.size() - 1, T{ 0 });
+	std::vector<T> chunk(n), product(2 * n - 1);
+
+	for (std::size_t i = 0; i < longer.size(); i += n)
+	{
+		const std::size_t length = std::min(n, longer.size() - i);
+
+		std::copy(longer.begin() + i, longer.begin() + i + length, chunk.begin());
+		std::fill(chunk.begin() + length, chunk.end(), T{ 0 });
+
+		karatsuba(shorter.data(), chunk.data(), n, product.data());
+
+		// Accumulate chunk product at its offset, discarding padded overflow.
+		for (std::size_t j = 0; j < product.size() && i + j < result.size(); j++)
+			result[i + j] += product[j];
+	}
+
+	return result;
+}
+
+// Karatsuba product of two n-term arrays into 2n - 1 term output.
+template<typename T>
+void Polynomial<T>::karatsuba(const T* a, const T* b, const std::size_t n, T* product)
+{
+	// Schoolbook multiplication for small operands.
+	if (n <= karatsubaCutoff)
+	{
+		std::fill(product, product + 2 * n - 1, T{ 0 });
+
+		for (std::size_t i = 0; i < n; i++)
+			for (std::size_t j = 0; j < n; j++)
+				product[i + j] += a[i] * b[j];
+
+		return;
+	}
+
+	// Split into low half of m terms and high half of h >= m terms.
+	const std::size_t m = n / 2;
+	const std::size_t h = n - m;
+
+	// z0 = a0 * b0 and z2 = a1 * b1 are placed directly into the product.
+	karatsuba(a, b, m, product);
+	product[2 * m - 1] = T{ 0 };
+	karatsuba(a + m, b + m, h, product + 2 * m);
+
+	// z1 = (a0 + a1) * (b0 + b1) - z0 - z2.
+	std::vector<T> sumA(a + m, a + n), sumB(b + m, b + n), z1(2 * h - 1);
+
+	for (std::size_t i = 0; i < m; i++)
+	{
+		sumA[i] += a[i];
+		sumB[i] += b[i];
+	}
+
+	karatsuba(sumA.data(), sumB.data(), h, z1.data());
+
+	for (std::size_t i = 0; i < 2 * m - 1; i++)
+		z1[i] -= product[i];
+	for (std::size_t i = 0; i < 2 * h - 1; i++)
+		z1[i] -= product[2 * m + i];
+
+	// Add middle product at offset m.
+	for (std::size_t i = 0; i < 2 * h - 1; i++)
+		product[m + i] += z1[i];
+}
+
+// Stream product terms to sink(exponent, coefficient) in ascending exponent order.
+//
+// Johnson's heap merge: the product is the merge of one sorted stream per
+// term of the shorter operand (that term times every term of the longer),
+// so a min-heap holding the head of each stream yields the product terms
+// in order. Like terms leave the heap together and are combined before the
+// sink sees them, and zero sums are skipped. Memory is O(min(n, m)).
+template<typename T>
+template<typename Sink>
+void Polynomial<T>::multiplyTerms(const Polynomial<T>& a, const Polynomial<T>& b, Sink sink)
+{
+	if (a.terms().empty() || b.terms().empty())
+		return;
+
+	const std::map<unsigned, T>& shorter = (a.terms().size() <= b.terms().size()) ? a.terms() : b.terms();
+	const std::map<unsigned, T>& longer = (a.terms().size() <= b.terms().size()) ? b.terms() : a.terms();
+
+	// Stream i multiplies row[i] by the longer operand, currently at column[i].
+	std::vector<typename std::map<unsigned, T>::const_iterator> row, column;
+	// Heap of (exponent, stream) with the smallest exponent on top.
+	std::vector<std::pair<unsigned, std::size_t>> heap;
+	auto later = [](const std::pair<unsigned, std::size_t>& x, const std::pair<unsigned, std::size_t>& y) { return x.first > y.first; };
+
+	row.reserve(shorter.size());
+	column.reserve(shorter.size());
+	heap.reserve(shorter.size());
+
+	for (auto it = shorter.cbegin(); it != shorter.cend(); ++it)
+	{
+		heap.emplace_back(it->first + longer.cbegin()->first, row.size());
+		row.push_back(it);
+		column.push_back(longer.cbegin());
+	}
+	std::make_heap(heap.begin(), heap.end(), later);
+
+	while (!heap.empty())
+	{
+		const unsigned exponent = heap.front().first;
+		T sum{ 0 };
+
+		// Pop every stream head with this exponent, advancing each stream.
+		while (!heap.empty() && heap.front().first == exponent)
+		{
+			std::pop_heap(heap.begin(), heap.end(), later);
+			const std::size_t i = heap.back().second;
+			heap.pop_back();
+
+			sum += row[i]->second * column[i]->second;
+
+			if (++column[i] != longer.cend())
+			{
+				heap.emplace_back(row[i]->first + column[i]->first, i);
+				std::push_heap(heap.begin(), heap.end(), later);
+			}
+		}
+
+		if (sum != T{ 0 })
+			sink(exponent, sum);
+	}
+}
+
+// Tabulate p(x0 + i h) for i < count into out[i] by forward differences.
+//
+// After seeding, each value costs degree additions. The difference table
+// at a point x is seeded from q(t) = p(x + h t) rather than by differencing
+// neighbouring values, which would cancel catastrophically for small h:
+//   delta^k q(0) = sum over j >= k of q_j k! S(j, k),
+// with S the Stirling numbers of the second kind. With reseed > 0 the table
+// is rebuilt every reseed points to bound floating point drift. With
+// threads > 1 the grid is split into contiguous blocks, each seeded and
+// filled by its own thread.
+//
+// Differences grow past the values (the last is n! a_n h^n), so integral
+// coefficients are tabulated in the unsigned type of the same width. Its
+// arithmetic wraps modulo 2^N instead of overflowing, and every value that
+// fits in T comes out exact.
+template<typename T>
+template<typename RandomIt>
+void Polynomial<T>::tabulate(const T x0, const T h, const std::size_t count, RandomIt out, const std::size_t reseed, unsigned threads) const
+{
+	typedef typename std::conditional<std::is_integral<T>::value, std::make_unsigned<T>, std::enable_if<true, T>>::type::type Wide;
+
+	const std::vector<T> dense = toDense();
+	const std::vector<Wide> coefficients(dense.begin(), dense.end());
+	const std::size_t degree = coefficients.empty() ? 0 : coefficients.size() - 1;
+	const Wide start = Wide(x0), step = Wide(h);
+
+	// stirling[j][k] = k! S(j, k), from k! S(j, k) = k ((k - 1)! S(j - 1, k - 1) + k! S(j - 1, k)).
+	std::vector<std::vector<Wide>> stirling(degree + 1, std::vector<Wide>(degree + 1, Wide{ 0 }));
+	stirling[0][0] = Wide{ 1 };
+	for (std::size_t j = 1; j <= degree; j++)
+		for (std::size_t k = 1; k <= j; k++)
+			stirling[j][k] = Wide(k) * (stirling[j - 1][k - 1] + stirling[j - 1][k]);
+
+	// Fill out[first, last).
+	auto block = [&](const std::size_t first, const std::size_t last)
+	{
+		std::vector<Wide> q(degree + 1), table(degree + 1);
+
+		for (std::size_t i = first; i < last; )
+		{
+			// q(t) = p(x + h t): Taylor shift to x by synthetic division, then scale by h^j.
+			const Wide x = start + Wide(i) * step;
+			std::fill(q.begin(), q.end(), Wide{ 0 });
+			std::copy(coefficients.begin(), coefficients.end(), q.begin());
+			for (std::size_t m = 0; m < degree; m++)
+				for (std::size_t j = degree; j-- > m; )
+					q[j] += x * q[j + 1];
+
+			Wide power{ 1 };
+			for (std::size_t j = 0; j <= degree; j++)
+			{
+				q[j] *= power;
+				power *= step;
+			}
+
+			// Difference table from q's coefficients.
+			for (std::size_t k = 0; k <= degree; k++)
+			{
+				table[k] = Wide{ 0 };
+				for (std::size_t j = k; j <= degree; j++)
+					table[k] += q[j] * stirling[j][k];
+			}
+
+			const std::size_t stop = reseed ? std::min(last, i + reseed) : last;
+
+			for (; i < stop; i++)
+			{
+				out[i] = T(table[0]);
+				for (std::size_t k = 0; k < degree; k++)
+					table[k] += table[k + 1];
+			}
+		}
+	};
+
+	// Keep blocks long enough to amortize their seeding.
+	threads = static_cast<unsigned>(std::max<std::size_t>(1, std::min<std::size_t>(threads, count / (16 * (degree + 1)))));
+
+	if (threads == 1)
+	{
+		block(0, count);
+		return;
+	}
+
+	std::vector<std::thread> pool;
+	for (unsigned t = 0; t < threads; t++)
+		pool.emplace_back(block, count * t / threads, count * (t + 1) / threads);
+	for (auto& t : pool)
+		t.join();
+}
+
+// Compose polynomials, returning p(q(x)).
+//
+// Uses the Brent-Kung baby-step/giant-step scheme: p is cut into blocks of
+// k = ceil(sqrt(n)) coefficients, each block is evaluated at q from the
+// precomputed powers q^0 ... q^(k-1), and the blocks are combined by Horner's
+// rule in q^k. This needs about 2 sqrt(n) polynomial multiplications instead
+// of the n required by plain Horner.
+template<typename T>
+Polynomial<T> compose(const Polynomial<T>& p, const Polynomial<T>& q)
+{
+	Polynomial<T> result;
+
+	if (p.begin() == p.end())
+		return result;
+
+	const unsigned n = std::prev(p.end())->first + 1;
+	const unsigned k = std::max(1u, static_cast<unsigned>(std::ceil(std::sqrt(static_cast<double>(n)))));
+
+	// Baby steps, q^0 ... q^k.
+	std::vector<Polynomial<T>> powers(k + 1);
+	powers[0].setTerm(0, T{ 1 });
+	for (unsigned i = 1; i <= k; i++)
+		powers[i] = powers[i - 1] * q;
+
+	// Giant steps, Horner's rule in q^k over blocks from highest to lowest.
+	auto it = p.end();
+
+	for (unsigned block = (n + k - 1) / k; block-- > 0; )
+	{
+		result = result * powers[k];
+
+		// Evaluate block at q as a linear combination of baby steps.
+		Polynomial<T> sum;
+
+		while (it != p.begin() && std::prev(it)->first >= block * k)
+		{
+			--it;
+			for (auto& t : powers[it->first - block * k])
+				sum.setTerm(t.first, it->second * t.second);
+		}
+
+		result += sum;
+	}
+
+	return result;
+}
+
+// Shift polynomial argument, returning p(x + a).
+//
+// Divide and conquer: with p = lo + x^m hi, p(x + a) = lo(x + a) +
+// (x + a)^m hi(x + a), where the (x + a)^(2^i) are precomputed by repeated
+// squaring. The result costs O(M(n) log n) and is exact for integer types.
+template<typename T>
+Polynomial<T> taylorShift(const Polynomial<T>& p, const T a)
+{
+	if (p.begin() == p.end())
+		return Polynomial<T>();
+
+	// Blocks of this many coefficients are shifted directly in O(n^2).
+	const std::size_t directCutoff = 16;
+
+	std::vector<T> coefficients(std::prev(p.end())->first + std::size_t{ 1 }, T{ 0 });
+	for (auto& t : p)
+		coefficients[t.first] = t.second;
+
+	// Smallest level with 2^level >= n coefficients.
+	std::size_t level = 0;
+	while ((std::size_t{ 1 } << level) < coefficients.size())
+		level++;
+
+	// Powers (x + a)^(2^i) for each split below the top level.
+	std::vector<Polynomial<T>> powers{ Polynomial<T>({ { 1, T{ 1 } }, { 0, a } }) };
+	while (powers.size() < level)
+		powers.push_back(powers.back() * powers.back());
+
+	// Shift the block of 2^level coefficients starting at first.
+	auto shift = [&](auto& self, const std::size_t first, const std::size_t level) -> Polynomial<T>
+	{
+		const std::size_t last = std::min(first + (std::size_t{ 1 } << level), coefficients.size());
+
+		if (first >= last)
+			return Polynomial<T>();
+
+		if (last - first <= directCutoff)
+		{
+			// Repeated synthetic division by (x - a), in place.
+			std::vector<T> d(coefficients.begin() + first, coefficients.begin() + last);
+
+			for (std::size_t i = 0; i + 1 < d.size(); i++)
+				for (std::size_t j = d.size() - 1; j-- > i; )
+					d[j] += a * d[j + 1];
+
+			Polynomial<T> result;
+			for (std::size_t i = 0; i < d.size(); i++)
+				result.setTerm(static_cast<unsigned>(i), d[i]);
+
+			return result;
+		}
+
+		const std::size_t half = std::size_t{ 1 } << (level - 1);
+
+		return self(self, first, level - 1) + self(self, first + half, level - 1) * powers[level - 1];
+	};
+
+	return shift(shift, 0, level);
+}
+
+// Hash polynomials by fingerprint, for unordered containers.
+namespace std
+{
+	template<typename T>
+	struct hash<Polynomial<T>>
+	{
+		size_t operator() (const Polynomial<T>& p) const
+		{
+			return static_cast<size_t>(p.fingerprint());
+		}
+	};
+}
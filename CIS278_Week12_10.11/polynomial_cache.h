@@ -0,0 +1,180 @@
+/*************************************************************************
+* Title: Polynomial Operation Cache
+* File: polynomial_cache.h
+* Date: 10/19/2026
+*
+* Bounded least-recently-used cache of polynomial products, quotients and
+* remainders, keyed by the operands' fingerprints.
+*
+* Notes:
+*  (1) A hit is confirmed by comparing the cached operands with the new
+*      ones, so a fingerprint collision can never return a wrong result.
+*      Operands are kept as copy-on-write copies, which cost a reference
+*      count each.
+*  (2) The cache is safe to share between threads. Results are computed
+*      outside the lock.
+*************************************************************************
+* Change Log:
+*   10/19/2026: Initial release.
+*************************************************************************/
+#pragma once
+
+#include <list>          // recency order
+#include <unordered_map> // fingerprint index
+#include <mutex>         // shared use
+#include <cstdint>       // uint64_t
+
+#include "polynomial.h"
+
+template<typename T>
+class PolynomialCache
+{
+private:
+	// Cached operations.
+	enum class Operation : unsigned char { multiply, divide, modulus };
+
+	// Operation and operand fingerprints.
+	struct Key
+	{
+		Operation operation;
+		std::uint64_t lhs, rhs;
+
+		bool operator== (const Key& k) const { return operation == k.operation && lhs == k.lhs && rhs == k.rhs; }
+	};
+
+	// Combine key fields into one hash.
+	struct KeyHash
+	{
+		std::size_t operator() (const Key& k) const
+		{
+			return static_cast<std::size_t>((k.lhs * 0x9E3779B97F4A7C15ull) ^ (k.rhs + static_cast<std::uint64_t>(k.operation)));
+		}
+	};
+
+	// Cached operands and result.
+	struct Entry
+	{
+		Key key;
+		Polynomial<T> lhs, rhs, result;
+	};
+
+	// Maximum number of entries.
+	std::size_t capacity;
+	// Entries, most recently used first.
+	std::list<Entry> entries;
+	// Entry lookup by key.
+	std::unordered_map<Key, typename std::list<Entry>::iterator, KeyHash> index;
+	// Hit and miss counts.
+	std::size_t hitCount = 0, missCount = 0;
+	// Guards all of the above.
+	mutable std::mutex lock;
+
+	// Return cached result of operation, computing and storing it on a miss.
+	template<typename Compute>
+	Polynomial<T> lookup(const Operation operation, const Polynomial<T>& lhs, const Polynomial<T>& rhs, Compute compute);
+
+public:
+	// Cache holding at most capacity results.
+	explicit PolynomialCache(const std::size_t capacity) : capacity(capacity) { }
+
+	// Memoized lhs * rhs.
+	Polynomial<T> multiply(const Polynomial<T>& lhs, const Polynomial<T>& rhs);
+	// Memoized lhs / rhs.
+	Polynomial<T> divide(const Polynomial<T>& lhs, const Polynomial<T>& rhs);
+	// Memoized lhs % rhs.
+	Polynomial<T> modulus(const Polynomial<T>& lhs, const Polynomial<T>& rhs);
+
+	// Getter functions for statistics.
+	std::size_t size() const { std::lock_guard<std::mutex> guard(lock); return entries.size(); }
+	std::size_t hits() const { std::lock_guard<std::mutex> guard(lock); return hitCount; }
+	std::size_t misses() const { std::lock_guard<std::mutex> guard(lock); return missCount; }
+
+	// Remove all entries.
+	void clear();
+};
+
+// Return cached result of operation, computing and storing it on a miss.
+template<typename T>
+template<typename Compute>
+Polynomial<T> PolynomialCache<T>::lookup(const Operation operation, const Polynomial<T>& lhs, const Polynomial<T>& rhs, Compute compute)
+{
+	const Key key{ operation, lhs.fingerprint(), rhs.fingerprint() };
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = index.find(key);
+
+		// Confirm operands, then move entry to the front.
+		if (it != index.end() && it->second->lhs == lhs && it->second->rhs == rhs)
+		{
+			hitCount++;
+			entries.splice(entries.begin(), entries, it->second);
+			return it->second->result;
+		}
+
+		missCount++;
+	}
+
+	// Compute without holding the lock.
+	const Polynomial<T> result = compute();
+
+	if (capacity == 0)
+		return result;
+
+	std::lock_guard<std::mutex> guard(lock);
+
+	// Replace any entry with this key (another thread's, or a collision).
+	auto it = index.find(key);
+	if (it != index.end())
+	{
+		entries.erase(it->second);
+		index.erase(it);
+	}
+
+	entries.push_front(Entry{ key, lhs, rhs, result });
+	index.emplace(key, entries.begin());
+
+	// Evict least recently used.
+	if (entries.size() > capacity)
+	{
+		index.erase(entries.back().key);
+		entries.pop_back();
+	}
+
+	return result;
+}
+
+// Memoized lhs * rhs.
+template<typename T>
+Polynomial<T> PolynomialCache<T>::multiply(const Polynomial<T>& lhs, const Polynomial<T>& rhs)
+{
+	// Multiplication commutes, so order operands to share one entry.
+	if (rhs.fingerprint() < lhs.fingerprint())
+		return multiply(rhs, lhs);
+
+	return lookup(Operation::multiply, lhs, rhs, [&]() { return lhs * rhs; });
+}
+
+// Memoized lhs / rhs.
+template<typename T>
+Polynomial<T> PolynomialCache<T>::divide(const Polynomial<T>& lhs, const Polynomial<T>& rhs)
+{
+	return lookup(Operation::divide, lhs, rhs, [&]() { return lhs / rhs; });
+}
+
+// Memoized lhs % rhs.
+template<typename T>
+Polynomial<T> PolynomialCache<T>::modulus(const Polynomial<T>& lhs, const Polynomial<T>& rhs)
+{
+	return lookup(Operation::modulus, lhs, rhs, [&]() { return lhs % rhs; });
+}
+
+// Remove all entries.
+template<typename T>
+void PolynomialCache<T>::clear()
+{
+	std::lock_guard<std::mutex> guard(lock);
+
+	entries.clear();
+	index.clear();
+}
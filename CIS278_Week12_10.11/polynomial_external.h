@@ -0,0 +1,492 @@
+/*************************************************************************
+* Title: External Memory Polynomial Multiplication
+* File: polynomial_external.h
+* Date: 10/19/2026
+*
+* Multiplication of dense polynomials too large for memory. Operands and
+* result are files of raw coefficients (element i is the coefficient of
+* x^i), accessed through memory-mapped windows one block at a time.
+*
+* Notes:
+*  (1) Operands are cut into blocks of blockSize coefficients. Output block
+*      s is the sum of the block products A_i B_j with i + j = s, so output
+*      blocks are finished, and written, strictly in order. Resident memory
+*      is a few blocks, however large the operands.
+*  (2) Floating point block products are summed in the frequency domain.
+*      Every block is transformed once, two blocks per complex FFT, into a
+*      scratch file of spectra beside the result (about twice the operand
+*      size, deleted when done). Each pair then costs a pointwise product
+*      and each output block one inverse FFT. Integer block products use
+*      exact Karatsuba multiplication instead.
+*  (3) Coefficient types must be trivially copyable. Files are in native
+*      byte order.
+*  (4) Uses POSIX mmap, or file mappings when compiled for Windows.
+*************************************************************************
+* Change Log:
+*   10/19/2026: Initial release.
+*   10/19/2026: Block transforms computed once and cached, instead of one
+*               FFT per block pair; B blocks read in ascending order. File
+*               size queries checked. Scratch files get unique names.
+*************************************************************************/
+#pragma once
+
+#include <string>      // file names
+#include <vector>      // block buffers
+#include <complex>     // block transforms
+#include <cstdint>     // uint64_t
+#include <cstring>     // memcpy
+#include <chrono>      // throughput
+#include <functional>  // progress callback
+#include <stdexcept>   // runtime_error
+#include <type_traits>
+#include <algorithm>   // min, max
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <stdlib.h>    // mkstemp
+#endif
+
+#include "polynomial.h"
+#include "fft.h"
+
+// Memory-mapped file, mapped one window at a time.
+class MappedFile
+{
+public:
+	// Open existing file read only, or create (truncate) a writable file of given size,
+	// or create a new writable scratch file, named path plus a unique suffix, that is
+	// deleted when closed.
+	enum class Mode { read, create, scratch };
+
+	// Mapped window of a file, unmapped on destruction.
+	class View
+	{
+	private:
+		friend class MappedFile;
+
+		// Mapping start (offset aligned down) and length.
+		void* base = nullptr;
+		std::size_t length = 0;
+		// Requested offset within the mapping.
+		char* start = nullptr;
+
+		View(void* b, const std::size_t l, char* s) : base(b), length(l), start(s) { }
+
+	public:
+		View(View&& v) noexcept : base(v.base), length(v.length), start(v.start) { v.base = nullptr; }
+		View(const View&) = delete;
+		View& operator= (const View&) = delete;
+		~View();
+
+		// Pointer to the requested offset.
+		char* data() const { return start; }
+	};
+
+	MappedFile(const std::string& path, const Mode mode, const std::uint64_t size = 0);
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator= (const MappedFile&) = delete;
+	~MappedFile();
+
+	// Getter function for file size in bytes.
+	std::uint64_t size() const { return bytes; }
+
+	// Map length bytes at offset.
+	View map(const std::uint64_t offset, const std::size_t length) const;
+
+private:
+	Mode mode;
+	std::uint64_t bytes = 0;
+	// Mapping offsets must be multiples of this.
+	std::uint64_t granularity = 4096;
+
+#ifdef _WIN32
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = nullptr;
+#else
+	int file = -1;
+#endif
+};
+
+#ifdef _WIN32
+
+inline MappedFile::MappedFile(const std::string& path, const Mode mode, const std::uint64_t size) : mode(mode)
+{
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	granularity = info.dwAllocationGranularity;
+
+	if (mode == Mode::scratch)
+	{
+		// Never replace an existing file: try suffixes until one is new.
+		for (unsigned attempt = 0; file == INVALID_HANDLE_VALUE && attempt < 100; attempt++)
+		{
+			const std::string name = path + "." + std::to_string(GetCurrentProcessId()) + "." + std::to_string(GetTickCount64() + attempt);
+
+			file = CreateFileA(name.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+				CREATE_NEW, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+			if (file == INVALID_HANDLE_VALUE && GetLastError() != ERROR_FILE_EXISTS)
+				break;
+		}
+	}
+	else
+		file = CreateFileA(path.c_str(), mode == Mode::read ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE,
+			FILE_SHARE_READ, nullptr, mode == Mode::read ? OPEN_EXISTING : CREATE_ALWAYS, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		throw std::runtime_error("Cannot open " + path);
+
+	if (mode == Mode::read)
+	{
+		LARGE_INTEGER s;
+		if (!GetFileSizeEx(file, &s))
+		{
+			CloseHandle(file);
+			throw std::runtime_error("Cannot size " + path);
+		}
+		bytes = static_cast<std::uint64_t>(s.QuadPart);
+	}
+	else
+		bytes = size;
+
+	// Creating the mapping also sizes a new file. Empty files cannot be mapped.
+	if (bytes)
+	{
+		mapping = CreateFileMappingA(file, nullptr, mode == Mode::read ? PAGE_READONLY : PAGE_READWRITE,
+			static_cast<DWORD>(bytes >> 32), static_cast<DWORD>(bytes), nullptr);
+		if (!mapping)
+		{
+			CloseHandle(file);
+			throw std::runtime_error("Cannot map " + path);
+		}
+	}
+}
+
+inline MappedFile::~MappedFile()
+{
+	if (mapping)
+		CloseHandle(mapping);
+	CloseHandle(file);
+}
+
+inline MappedFile::View MappedFile::map(const std::uint64_t offset, const std::size_t length) const
+{
+	const std::uint64_t aligned = offset - offset % granularity;
+	const std::size_t span = static_cast<std::size_t>(offset - aligned) + length;
+
+	void* base = MapViewOfFile(mapping, mode == Mode::read ? FILE_MAP_READ : FILE_MAP_WRITE,
+		static_cast<DWORD>(aligned >> 32), static_cast<DWORD>(aligned), span);
+	if (!base)
+		throw std::runtime_error("Cannot map file view");
+
+	return View(base, span, static_cast<char*>(base) + (offset - aligned));
+}
+
+inline MappedFile::View::~View()
+{
+	if (base)
+		UnmapViewOfFile(base);
+}
+
+#else
+
+inline MappedFile::MappedFile(const std::string& path, const Mode mode, const std::uint64_t size) : mode(mode)
+{
+	granularity = static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+
+	if (mode == Mode::scratch)
+	{
+		// mkstemp creates a new file (O_EXCL) under a unique name, unlinked
+		// at once so it lives only until closed.
+		std::string name = path + ".XXXXXX";
+
+		file = mkstemp(&name[0]);
+		if (file >= 0)
+			unlink(name.c_str());
+	}
+	else
+		file = (mode == Mode::read) ? open(path.c_str(), O_RDONLY) : open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (file < 0)
+		throw std::runtime_error("Cannot open " + path);
+
+	if (mode == Mode::read)
+	{
+		struct stat s;
+		if (fstat(file, &s) != 0)
+		{
+			close(file);
+			throw std::runtime_error("Cannot size " + path);
+		}
+		bytes = static_cast<std::uint64_t>(s.st_size);
+	}
+	else
+	{
+		bytes = size;
+		if (ftruncate(file, static_cast<off_t>(bytes)) != 0)
+		{
+			close(file);
+			throw std::runtime_error("Cannot size " + path);
+		}
+	}
+}
+
+inline MappedFile::~MappedFile()
+{
+	close(file);
+}
+
+inline MappedFile::View MappedFile::map(const std::uint64_t offset, const std::size_t length) const
+{
+	const std::uint64_t aligned = offset - offset % granularity;
+	const std::size_t span = static_cast<std::size_t>(offset - aligned) + length;
+
+	void* base = mmap(nullptr, span, mode == Mode::read ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, file, static_cast<off_t>(aligned));
+	if (base == MAP_FAILED)
+		throw std::runtime_error("Cannot map file view");
+
+	// Windows are read or written front to back, once.
+	madvise(base, span, MADV_SEQUENTIAL);
+
+	return View(base, span, static_cast<char*>(base) + (offset - aligned));
+}
+
+inline MappedFile::View::~View()
+{
+	if (base)
+		munmap(base, length);
+}
+
+#endif
+
+// Progress of an external multiplication.
+struct ExternalProgress
+{
+	// Block products done and total.
+	std::uint64_t blocksDone = 0, blocksTotal = 0;
+	// Bytes mapped from the operands (and their cached spectra) and written to the result.
+	std::uint64_t bytesRead = 0, bytesWritten = 0;
+	// Forward FFTs of operand blocks, floating point only.
+	std::uint64_t transforms = 0;
+	// Time since start.
+	double seconds = 0.;
+
+	// Operand and result bytes per second.
+	double throughput() const { return seconds > 0. ? double(bytesRead + bytesWritten) / seconds : 0.; }
+};
+
+// Options for external multiplication.
+struct ExternalOptions
+{
+	// Coefficients per block, rounded up to a power of two. Resident memory
+	// is about a dozen blocks of doubles, transform buffers included.
+	std::size_t blockSize = std::size_t{ 1 } << 20;
+	// Called after each output block.
+	std::function<void(const ExternalProgress&)> progress;
+};
+
+// Write polynomial coefficients x^0 ... x^degree to a coefficient file.
+template<typename T>
+void saveCoefficients(const std::string& path, const Polynomial<T>& p)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Coefficient files require trivially copyable coefficients");
+
+	const std::vector<T> c = p.toDense();
+	MappedFile file(path, MappedFile::Mode::create, c.size() * sizeof(T));
+
+	if (!c.empty())
+		std::memcpy(file.map(0, c.size() * sizeof(T)).data(), c.data(), c.size() * sizeof(T));
+}
+
+// Read polynomial from a coefficient file.
+template<typename T>
+Polynomial<T> loadCoefficients(const std::string& path)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Coefficient files require trivially copyable coefficients");
+
+	MappedFile file(path, MappedFile::Mode::read);
+	std::vector<T> c(static_cast<std::size_t>(file.size() / sizeof(T)));
+
+	if (!c.empty())
+		std::memcpy(c.data(), file.map(0, c.size() * sizeof(T)).data(), c.size() * sizeof(T));
+
+	return Polynomial<T>::fromDense(c);
+}
+
+// Multiply coefficient files a and b into coefficient file result.
+//
+// Output blocks are produced in order: block s accumulates A_(s-j) B_j
+// for every valid j, ascending, in a buffer of two blocks, whose low half
+// is then final and written while the high half carries into block s + 1.
+template<typename T>
+void multiplyExternal(const std::string& a, const std::string& b, const std::string& result, const ExternalOptions& options = ExternalOptions())
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Coefficient files require trivially copyable coefficients");
+
+	const auto start = std::chrono::steady_clock::now();
+
+	MappedFile fileA(a, MappedFile::Mode::read), fileB(b, MappedFile::Mode::read);
+	const std::uint64_t na = fileA.size() / sizeof(T), nb = fileB.size() / sizeof(T);
+	const std::uint64_t nr = (na && nb) ? na + nb - 1 : 0;
+
+	MappedFile fileR(result, MappedFile::Mode::create, nr * sizeof(T));
+	if (nr == 0)
+		return;
+
+	std::size_t block = 1;
+	while (block < options.blockSize)
+		block *= 2;
+
+	const std::uint64_t blocksA = (na + block - 1) / block, blocksB = (nb + block - 1) / block;
+
+	ExternalProgress progress;
+	for (std::uint64_t s = 0; s + 1 < blocksA + blocksB; s++)
+		progress.blocksTotal += std::min(s, blocksA - 1) + 1 - (s >= blocksB ? s - blocksB + 1 : 0);
+
+	// Copy block i of file (n coefficients) into x, zero padded to block.
+	auto load = [block, &progress](const MappedFile& file, const std::uint64_t n, const std::uint64_t i, std::vector<T>& x)
+	{
+		const std::size_t length = static_cast<std::size_t>(std::min<std::uint64_t>(block, n - i * block));
+
+		std::fill(x.begin(), x.end(), T{ 0 });
+		std::memcpy(x.data(), file.map(i * block * sizeof(T), length * sizeof(T)).data(), length * sizeof(T));
+		progress.bytesRead += length * sizeof(T);
+	};
+
+	std::vector<T> x(block), y(block);
+	// Output blocks s and s + 1.
+	std::vector<T> sum(2 * block, T{ 0 });
+
+	// Output block s done: low half is final, write it and carry the high half.
+	auto flush = [&](const std::uint64_t s)
+	{
+		const std::uint64_t offset = s * block;
+		const std::size_t length = static_cast<std::size_t>(std::min<std::uint64_t>(block, nr - offset));
+		std::memcpy(fileR.map(offset * sizeof(T), length * sizeof(T)).data(), sum.data(), length * sizeof(T));
+		progress.bytesWritten += length * sizeof(T);
+
+		std::copy(sum.begin() + block, sum.end(), sum.begin());
+		std::fill(sum.begin() + block, sum.end(), T{ 0 });
+
+		// Last output block also flushes the carry.
+		if (s + 2 == blocksA + blocksB && offset + block < nr)
+		{
+			const std::size_t rest = static_cast<std::size_t>(nr - offset - block);
+			std::memcpy(fileR.map((offset + block) * sizeof(T), rest * sizeof(T)).data(), sum.data(), rest * sizeof(T));
+			progress.bytesWritten += rest * sizeof(T);
+		}
+
+		if (options.progress)
+		{
+			progress.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			options.progress(progress);
+		}
+	};
+
+	if constexpr (std::is_floating_point<T>::value)
+	{
+		// Block spectra have length 2 block; real input makes them conjugate
+		// symmetric, so bins 0 ... block are kept.
+		const std::size_t length = 2 * block, bins = block + 1, bytes = bins * sizeof(std::complex<double>);
+
+		MappedFile spectraA(result + ".spectra", MappedFile::Mode::scratch, blocksA * bytes);
+		MappedFile spectraB(result + ".spectra", MappedFile::Mode::scratch, blocksB * bytes);
+
+		std::vector<std::complex<double>> z(length), p(bins), q(bins);
+
+		// Transform blocks i and i + 1 at once: with Z the FFT of x + iy,
+		// X_k = (Z_k + conj(Z_(-k))) / 2 and Y_k = (Z_k - conj(Z_(-k))) / 2i.
+		auto transform = [&](const MappedFile& file, const std::uint64_t n, const std::uint64_t blocks, const MappedFile& spectra)
+		{
+			for (std::uint64_t i = 0; i < blocks; i += 2)
+			{
+				load(file, n, i, x);
+				if (i + 1 < blocks)
+					load(file, n, i + 1, y);
+				else
+					std::fill(y.begin(), y.end(), T{ 0 });
+
+				for (std::size_t k = 0; k < block; k++)
+					z[k] = std::complex<double>(double(x[k]), double(y[k]));
+				std::fill(z.begin() + block, z.end(), std::complex<double>());
+
+				fft(z);
+				progress.transforms++;
+
+				for (std::size_t k = 0; k < bins; k++)
+				{
+					const std::complex<double> u = z[k], v = std::conj(z[(length - k) % length]);
+					p[k] = (u + v) * .5;
+					q[k] = (u - v) * std::complex<double>(0., -.5);
+				}
+
+				std::memcpy(spectra.map(i * bytes, bytes).data(), p.data(), bytes);
+				if (i + 1 < blocks)
+					std::memcpy(spectra.map((i + 1) * bytes, bytes).data(), q.data(), bytes);
+			}
+		};
+
+		transform(fileA, na, blocksA, spectraA);
+		transform(fileB, nb, blocksB, spectraB);
+
+		// Spectrum of the products of output block s.
+		std::vector<std::complex<double>> spectrum(bins);
+
+		for (std::uint64_t s = 0; s + 1 < blocksA + blocksB; s++)
+		{
+			const std::uint64_t first = (s >= blocksA) ? s - blocksA + 1 : 0, last = std::min(s, blocksB - 1);
+
+			std::fill(spectrum.begin(), spectrum.end(), std::complex<double>());
+
+			for (std::uint64_t j = first; j <= last; j++)
+			{
+				std::memcpy(p.data(), spectraA.map((s - j) * bytes, bytes).data(), bytes);
+				std::memcpy(q.data(), spectraB.map(j * bytes, bytes).data(), bytes);
+				progress.bytesRead += 2 * bytes;
+
+				for (std::size_t k = 0; k < bins; k++)
+					spectrum[k] += p[k] * q[k];
+
+				progress.blocksDone++;
+			}
+
+			// Restore the conjugate half and invert.
+			for (std::size_t k = 0; k < bins; k++)
+				z[k] = spectrum[k];
+			for (std::size_t k = 1; k < block; k++)
+				z[length - k] = std::conj(spectrum[k]);
+
+			fft(z, true);
+			for (std::size_t k = 0; k < length; k++)
+				sum[k] += T(z[k].real() / double(length));
+
+			flush(s);
+		}
+	}
+	else
+	{
+		for (std::uint64_t s = 0; s + 1 < blocksA + blocksB; s++)
+		{
+			const std::uint64_t first = (s >= blocksA) ? s - blocksA + 1 : 0, last = std::min(s, blocksB - 1);
+
+			for (std::uint64_t j = first; j <= last; j++)
+			{
+				load(fileA, na, s - j, x);
+				load(fileB, nb, j, y);
+
+				const std::vector<T> product = Polynomial<T>::denseMultiply(x, y);
+				for (std::size_t k = 0; k < product.size(); k++)
+					sum[k] += product[k];
+
+				progress.blocksDone++;
+			}
+
+			flush(s);
+		}
+	}
+}
@@ -0,0 +1,400 @@
+/*************************************************************************
+* Title: Polynomial Resultants and Discriminants
+* File: polynomial_resultant.h
+* Date: 10/19/2026
+*
+* Resultants, discriminants, pseudo-remainders and subresultant
+* polynomial remainder sequences over integer coefficients, in exact
+* arithmetic.
+*
+* Notes:
+*  (1) The subresultant PRS divides each pseudo-remainder by a known
+*      factor (exactly), which keeps coefficient growth linear in the
+*      degree instead of exponential as with plain pseudo-division.
+*  (2) Results grow quickly, so for int or long long coefficients use
+*      BigInt or the modular versions. resultantModular and
+*      discriminantModular compute the result modulo enough 31-bit
+*      primes to exceed Hadamard's bound and combine them by the
+*      Chinese remainder theorem, returning a BigInt. Each prime costs
+*      O(mn) word operations with no coefficient growth at all.
+*************************************************************************
+* Change Log:
+*   10/19/2026: Initial release.
+*   10/19/2026: Norm bound computed in the log domain, finite for BigInt
+*               coefficients past the double range.
+*************************************************************************/
+#pragma once
+
+#include <vector>    // coefficients
+#include <cstdint>   // uint64_t
+#include <cmath>     // log2, exp2
+#include <algorithm> // max
+#include <limits>    // infinity
+#include <stdexcept> // domain_error
+#include <utility>   // swap
+#include <type_traits>
+
+#include "polynomial.h"
+#include "bigint.h"
+
+namespace detail
+{
+	// Dense coefficients without trailing zeros.
+	template<typename T>
+	std::vector<T> trimmedDense(const Polynomial<T>& p)
+	{
+		std::vector<T> c = p.toDense();
+		while (!c.empty() && c.back() == T{ 0 })
+			c.pop_back();
+
+		return c;
+	}
+
+	// x^e by repeated squaring.
+	template<typename T>
+	T power(T x, unsigned e)
+	{
+		T result{ 1 };
+
+		for (; e; e >>= 1)
+		{
+			if (e & 1)
+				result = result * x;
+			if (e > 1)
+				x = x * x;
+		}
+
+		return result;
+	}
+
+	// lc(b)^(deg a - deg b + 1) a mod b, requires deg a >= deg b.
+	template<typename T>
+	std::vector<T> pseudoRemainder(std::vector<T> a, const std::vector<T>& b)
+	{
+		const T lead = b.back();
+
+		// Each step scales by lead and eliminates the leading term of a.
+		while (a.size() >= b.size())
+		{
+			const T c = a.back();
+			const std::size_t offset = a.size() - b.size();
+
+			for (auto& x : a)
+				x = x * lead;
+			for (std::size_t i = 0; i < b.size(); i++)
+				a[offset + i] -= c * b[i];
+
+			a.pop_back();
+		}
+
+		while (!a.empty() && a.back() == T{ 0 })
+			a.pop_back();
+
+		return a;
+	}
+
+	// Subresultant PRS of a and b, deg a >= deg b > 0 (Collins, Brown and
+	// Traub). Appends the sequence to prs if given, returns the resultant.
+	template<typename T>
+	T subresultant(std::vector<T> a, std::vector<T> b, std::vector<std::vector<T>>* prs)
+	{
+		T g{ 1 }, h{ 1 }, sign{ 1 };
+
+		if (prs)
+		{
+			prs->push_back(a);
+			prs->push_back(b);
+		}
+
+		while (b.size() > 1)
+		{
+			const unsigned delta = static_cast<unsigned>(a.size() - b.size());
+
+			// res(a, b) = (-1)^(deg a deg b) res(b, a).
+			if ((a.size() - 1) % 2 == 1 && (b.size() - 1) % 2 == 1)
+				sign = -sign;
+
+			std::vector<T> r = pseudoRemainder(a, b);
+
+			// Common factor g h^delta divides the pseudo-remainder exactly.
+			const T divisor = g * power(h, delta);
+			for (auto& x : r)
+				x = x / divisor;
+
+			a.swap(b);
+			b.swap(r);
+
+			if (b.empty())
+				return T{ 0 };
+
+			if (prs)
+				prs->push_back(b);
+
+			// h' = g^delta / h^(delta - 1), exact.
+			g = a.back();
+			if (delta == 1)
+				h = g;
+			else if (delta > 1)
+				h = power(g, delta) / power(h, delta - 1);
+		}
+
+		// res = lc(b)^deg a / h^(deg a - 1).
+		const unsigned degree = static_cast<unsigned>(a.size() - 1);
+
+		return sign * power(b.back(), degree) / power(h, degree - 1);
+	}
+
+	// Resultant of a and b modulo prime p, by the Euclidean algorithm.
+	inline std::uint64_t resultantModulo(std::vector<std::uint64_t> a, std::vector<std::uint64_t> b, const std::uint64_t p)
+	{
+		auto trim = [](std::vector<std::uint64_t>& x) { while (!x.empty() && x.back() == 0) x.pop_back(); };
+		auto power = [p](std::uint64_t x, std::uint64_t e)
+		{
+			std::uint64_t result = 1;
+			for (x %= p; e; e >>= 1, x = x * x % p)
+				if (e & 1)
+					result = result * x % p;
+			return result;
+		};
+
+		trim(a);
+		trim(b);
+		if (a.empty() || b.empty())
+			return 0;
+
+		std::uint64_t result = 1;
+
+		while (b.size() > 1)
+		{
+			// Remainder of a by b.
+			const std::uint64_t inverse = power(b.back(), p - 2);
+			std::vector<std::uint64_t> r = a;
+			while (r.size() >= b.size())
+			{
+				const std::uint64_t factor = r.back() * inverse % p;
+				const std::size_t offset = r.size() - b.size();
+				for (std::size_t i = 0; i < b.size(); i++)
+					r[offset + i] = (r[offset + i] + (p - factor) * b[i]) % p;
+				r.pop_back();
+				trim(r);
+			}
+
+			if (r.empty())
+				return 0;
+
+			// res(a, b) = (-1)^(deg a deg b) lc(b)^(deg a - deg r) res(b, r).
+			if ((a.size() - 1) % 2 == 1 && (b.size() - 1) % 2 == 1)
+				result = (p - result) % p;
+			result = result * power(b.back(), a.size() - r.size()) % p;
+
+			a.swap(b);
+			b.swap(r);
+		}
+
+		return result * power(b.back(), a.size() - 1) % p;
+	}
+
+	// Coefficients reduced modulo p into [0, p).
+	template<typename T>
+	std::vector<std::uint64_t> residues(const std::vector<T>& c, const std::uint64_t p)
+	{
+		std::vector<std::uint64_t> r;
+
+		for (auto& x : c)
+		{
+			const long long v = static_cast<long long>(x % T(static_cast<long long>(p)));
+			r.push_back(static_cast<std::uint64_t>(v < 0 ? v + static_cast<long long>(p) : v));
+		}
+
+		return r;
+	}
+
+	// Exact conversion to BigInt.
+	template<typename T>
+	BigInt toBigInt(const T& x)
+	{
+		if constexpr (std::is_same<T, BigInt>::value)
+			return x;
+		else
+			return BigInt(static_cast<long long>(x));
+	}
+
+	// Base 2 logarithm of |x|, minus infinity for zero.
+	template<typename T>
+	double log2Abs(const T& x)
+	{
+		if constexpr (std::is_same<T, BigInt>::value)
+			return x.log2();
+		else
+			return std::log2(std::abs(double(x)));
+	}
+
+	// Euclidean norm of non-zero coefficients, as a base 2 logarithm. Squares
+	// are summed relative to the largest, so BigInt coefficients beyond the
+	// double range still give a finite bound.
+	template<typename T>
+	double log2Norm(const std::vector<T>& c)
+	{
+		double largest = -std::numeric_limits<double>::infinity();
+		for (auto& x : c)
+			largest = std::max(largest, log2Abs(x));
+
+		double sum = 0.;
+		for (auto& x : c)
+			sum += std::exp2(2. * (log2Abs(x) - largest));
+
+		return largest + 0.5 * std::log2(sum);
+	}
+}
+
+// Pseudo-remainder lc(b)^(deg a - deg b + 1) a mod b, exact over the integers.
+template<typename T>
+Polynomial<T> pseudoRemainder(const Polynomial<T>& a, const Polynomial<T>& b)
+{
+	const std::vector<T> x = detail::trimmedDense(a), y = detail::trimmedDense(b);
+
+	if (y.empty())
+		throw std::domain_error("Pseudo-remainder by zero polynomial");
+
+	if (x.size() < y.size())
+		return a;
+
+	return Polynomial<T>::fromDense(detail::pseudoRemainder(x, y));
+}
+
+// Subresultant polynomial remainder sequence of a and b, starting with the
+// operand of higher degree, ending at the last non-zero remainder.
+template<typename T>
+std::vector<Polynomial<T>> subresultantSequence(const Polynomial<T>& a, const Polynomial<T>& b)
+{
+	std::vector<T> x = detail::trimmedDense(a), y = detail::trimmedDense(b);
+
+	if (x.size() < y.size())
+		x.swap(y);
+
+	std::vector<std::vector<T>> prs;
+	if (y.size() > 1)
+		detail::subresultant(x, y, &prs);
+	else
+	{
+		prs.push_back(x);
+		if (!y.empty())
+			prs.push_back(y);
+	}
+
+	std::vector<Polynomial<T>> result;
+	for (auto& c : prs)
+		result.push_back(Polynomial<T>::fromDense(c));
+
+	return result;
+}
+
+// Resultant of a and b via the subresultant PRS, exact over the integers.
+template<typename T>
+T resultant(const Polynomial<T>& a, const Polynomial<T>& b)
+{
+	std::vector<T> x = detail::trimmedDense(a), y = detail::trimmedDense(b);
+
+	if (x.empty() || y.empty())
+		return T{ 0 };
+
+	T sign{ 1 };
+	if (x.size() < y.size())
+	{
+		// res(a, b) = (-1)^(deg a deg b) res(b, a).
+		if ((x.size() - 1) % 2 == 1 && (y.size() - 1) % 2 == 1)
+			sign = -sign;
+		x.swap(y);
+	}
+
+	// Constant operand.
+	if (y.size() == 1)
+		return sign * detail::power(y[0], static_cast<unsigned>(x.size() - 1));
+
+	return sign * detail::subresultant(x, y, static_cast<std::vector<std::vector<T>>*>(nullptr));
+}
+
+// Discriminant of p, (-1)^(n(n-1)/2) res(p, p') / lc(p), requires degree of one or more.
+template<typename T>
+T discriminant(const Polynomial<T>& p)
+{
+	const std::vector<T> c = detail::trimmedDense(p);
+
+	if (c.size() < 2)
+		throw std::domain_error("Discriminant of constant polynomial");
+
+	const std::size_t n = c.size() - 1;
+	const T r = resultant(p, p.differentiate()) / c.back();
+
+	return (n * (n - 1) / 2) % 2 ? -r : r;
+}
+
+// Resultant of a and b by the Chinese remainder theorem over 31-bit primes.
+template<typename T>
+BigInt resultantModular(const Polynomial<T>& a, const Polynomial<T>& b)
+{
+	const std::vector<T> x = detail::trimmedDense(a), y = detail::trimmedDense(b);
+
+	if (x.empty() || y.empty())
+		return BigInt();
+
+	// Hadamard: |res| <= |a|^deg b |b|^deg a, plus a sign bit and margin.
+	const double bits = double(y.size() - 1) * detail::log2Norm(x) + double(x.size() - 1) * detail::log2Norm(y) + 2.;
+
+	BigInt value, modulus(1);
+	double modulusBits = 0.;
+
+	for (std::uint64_t p = 2147483647; modulusBits < bits; p -= 2)
+	{
+		// Primes by trial division.
+		bool prime = true;
+		for (std::uint64_t d = 3; d * d <= p && prime; d += 2)
+			prime = p % d != 0;
+		if (!prime)
+			continue;
+
+		const std::vector<std::uint64_t> ra = detail::residues(x, p), rb = detail::residues(y, p);
+
+		// Skip primes dividing a leading coefficient, where the degree drops.
+		if (ra.back() == 0 || rb.back() == 0)
+			continue;
+
+		const std::uint64_t r = detail::resultantModulo(ra, rb, p);
+
+		// Garner's step: value += modulus ((r - value) / modulus mod p).
+		const BigInt P(static_cast<long long>(p));
+		const std::uint64_t v = static_cast<std::uint64_t>(static_cast<long long>(value % P));
+		const std::uint64_t m = static_cast<std::uint64_t>(static_cast<long long>(modulus % P));
+
+		std::uint64_t inverse = 1;
+		for (std::uint64_t base = m, e = p - 2; e; e >>= 1, base = base * base % p)
+			if (e & 1)
+				inverse = inverse * base % p;
+
+		const std::uint64_t t = (r + p - v) % p * inverse % p;
+		value += modulus * BigInt(static_cast<long long>(t));
+		modulus *= P;
+		modulusBits += std::log2(double(p));
+	}
+
+	// Symmetric range.
+	if (value + value > modulus)
+		value -= modulus;
+
+	return value;
+}
+
+// Discriminant of p by the Chinese remainder theorem, requires degree of one or more.
+template<typename T>
+BigInt discriminantModular(const Polynomial<T>& p)
+{
+	const std::vector<T> c = detail::trimmedDense(p);
+
+	if (c.size() < 2)
+		throw std::domain_error("Discriminant of constant polynomial");
+
+	const std::size_t n = c.size() - 1;
+	const BigInt r = resultantModular(p, p.differentiate()) / detail::toBigInt(c.back());
+
+	return (n * (n - 1) / 2) % 2 ? -r : r;
+}
@@ -0,0 +1,946 @@
+/*************************************************************************
+* Title: Polynomial Root Finding
+* File: polynomial_roots.h
+* Date: 10/19/2026
+*
+* Finds every complex root of a floating point Polynomial at once with
+* the Aberth-Ehrlich simultaneous iteration, and isolates real roots with
+* Descartes' rule of signs (VCA bisection) or counts them with Sturm
+* sequences.
+*
+* Notes:
+*  (1) Root estimates are kept as separate real and imaginary arrays and
+*      p, p' are evaluated by Horner's rule across all estimates at once,
+*      so the inner loops are straight-line arithmetic over contiguous
+*      arrays that the compiler can vectorize.
+*  (2) Many polynomials can be solved in parallel, one per worker thread.
+*  (3) Real root isolation is exact for integer coefficients, computed
+*      in BigInt for fixed width types. Floating point coefficients are
+*      rescaled by powers of two (exactly) and carry running error bounds;
+*      coefficients within their bound of zero have unknown sign, so an
+*      interval is only reported as isolating when the signs are sure.
+*  (4) Sturm sequences and counts are exact for every coefficient type,
+*      computed over BigInt (a double is an integer times a power of two).
+*************************************************************************
+* Change Log:
+*   10/19/2026: Initial release.
+*   10/19/2026: Added realRootIntervals, sturmSequence and sturmCount.
+*   10/19/2026: Aberth iteration stops on backward error too, and moves
+*               estimates off critical points instead of freezing them.
+*   10/19/2026: Exact Sturm sequences over BigInt, BigInt isolation for
+*               fixed width integers, running error bounds for floating
+*               point isolation.
+*************************************************************************/
+#pragma once
+
+#include <vector>    // coefficients, estimates
+#include <complex>   // roots
+#include <cmath>     // abs, pow, cos, sin
+#include <limits>    // epsilon
+#include <stdexcept> // domain_error
+#include <thread>    // parallel solve
+#include <atomic>    // work index
+#include <exception> // exception_ptr
+#include <type_traits>
+#include <algorithm> // sort, reverse
+#include <utility>   // move
+
+#include "polynomial.h"
+#include "bigint.h"
+
+// How a root estimate stopped iterating.
+enum class RootStop
+{
+	// Still moving at the iteration limit.
+	none,
+	// Correction below the step tolerance.
+	step,
+	// |p(z)| down to the rounding level of evaluating p at z.
+	residual
+};
+
+// Convergence report of the root iteration.
+struct RootReport
+{
+	// Number of iterations performed.
+	unsigned iterations = 0;
+	// True if every root estimate met a stopping criterion.
+	bool converged = false;
+	// Relative backward error |p(z)| / sum |a_i| |z|^i for each root.
+	std::vector<double> residuals;
+	// Stopping criterion met by each root.
+	std::vector<RootStop> stops;
+};
+
+// Root iteration settings.
+struct RootOptions
+{
+	// Iteration limit.
+	unsigned maxIterations = 200;
+	// Estimate converged when its correction is below tolerance * |z|.
+	double tolerance = 4 * std::numeric_limits<double>::epsilon();
+	// Estimate also converged when |p(z)| <= residual * n * sum |a_i| |z|^i,
+	// i.e. z is an exact root of a nearby polynomial. Multiple and clustered
+	// roots stop this way, their steps never become small.
+	double residual = 4 * std::numeric_limits<double>::epsilon();
+};
+
+// Find all complex roots of p, with multiplicity, via Aberth-Ehrlich iteration.
+template<typename T>
+std::vector<std::complex<T>> roots(const Polynomial<T>& p, RootReport* report = nullptr, const RootOptions& options = RootOptions())
+{
+	static_assert(std::is_floating_point<T>::value, "roots requires floating point coefficients");
+
+	// Dense coefficients, skipping any zero terms stored above the degree.
+	std::vector<T> a;
+	for (auto& t : p)
+		if (t.second != T{ 0 })
+		{
+			a.resize(t.first + std::size_t{ 1 }, T{ 0 });
+			a[t.first] = t.second;
+		}
+
+	if (a.empty())
+		throw std::domain_error("Roots of zero polynomial");
+
+	// Zero roots, removed as factors of x.
+	std::size_t zeros = 0;
+	while (a[zeros] == T{ 0 })
+		zeros++;
+	a.erase(a.begin(), a.begin() + zeros);
+
+	// Monic coefficients.
+	const std::size_t n = a.size() - 1;
+	const T lead = a[n];
+	for (auto& c : a)
+		c /= lead;
+
+	// Estimates stored as separate real and imaginary arrays.
+	std::vector<T> re(n), im(n);
+
+	// Start on a circle of radius |a0|^(1/n), rotated off the axes.
+	const T radius = std::pow(std::abs(a[0]), T{ 1 } / T(n ? n : 1));
+	const T pi = T(3.14159265358979323846);
+	for (std::size_t i = 0; i < n; i++)
+	{
+		const T angle = 2 * pi * T(i) / T(n) + T(0.4);
+		re[i] = radius * std::cos(angle);
+		im[i] = radius * std::sin(angle);
+	}
+
+	std::vector<T> pr(n), pim(n), dr(n), di(n), wr(n), wi(n), az(n), sc(n);
+	std::vector<RootStop> done(n, RootStop::none);
+	// Estimates to nudge off a critical point of p.
+	std::vector<char> stuck(n, 0);
+	const T threshold = T(options.residual) * T(n);
+	unsigned iteration = 0;
+	bool converged = (n == 0);
+
+	while (!converged && iteration < options.maxIterations)
+	{
+		iteration++;
+
+		// Horner's rule for p, p' and sum |a_j| |z|^j at every estimate,
+		// coefficient outer loop.
+		std::fill(pr.begin(), pr.end(), T{ 1 });
+		std::fill(pim.begin(), pim.end(), T{ 0 });
+		std::fill(dr.begin(), dr.end(), T{ 0 });
+		std::fill(di.begin(), di.end(), T{ 0 });
+		std::fill(sc.begin(), sc.end(), T{ 1 });
+		for (std::size_t i = 0; i < n; i++)
+			az[i] = std::sqrt(re[i] * re[i] + im[i] * im[i]);
+
+		for (std::size_t j = n; j-- > 0; )
+		{
+			const T c = a[j], m = std::abs(c);
+
+			for (std::size_t i = 0; i < n; i++)
+			{
+				const T zr = re[i], zi = im[i];
+				const T qr = dr[i] * zr - di[i] * zi + pr[i];
+				const T qi = dr[i] * zi + di[i] * zr + pim[i];
+				const T sr = pr[i] * zr - pim[i] * zi + c;
+				const T si = pr[i] * zi + pim[i] * zr;
+				dr[i] = qr;
+				di[i] = qi;
+				pr[i] = sr;
+				pim[i] = si;
+				sc[i] = sc[i] * az[i] + m;
+			}
+		}
+
+		// Aberth correction w = N / (1 - N sum 1 / (z_i - z_j)), N = p / p'.
+		for (std::size_t i = 0; i < n; i++)
+		{
+			wr[i] = wi[i] = T{ 0 };
+
+			if (done[i] != RootStop::none)
+				continue;
+
+			// Backward error stop, nothing more to gain from iterating.
+			if (std::sqrt(pr[i] * pr[i] + pim[i] * pim[i]) <= threshold * sc[i])
+			{
+				done[i] = RootStop::residual;
+				continue;
+			}
+
+			// p' vanishes away from a root: no Newton step exists.
+			const T den = dr[i] * dr[i] + di[i] * di[i];
+			if (den == T{ 0 })
+			{
+				stuck[i] = 1;
+				continue;
+			}
+
+			const T nr = (pr[i] * dr[i] + pim[i] * di[i]) / den;
+			const T ni = (pim[i] * dr[i] - pr[i] * di[i]) / den;
+
+			T sr{ 0 }, si{ 0 };
+			for (std::size_t j = 0; j < n; j++)
+			{
+				const T xr = re[i] - re[j], xi = im[i] - im[j];
+				const T m = xr * xr + xi * xi;
+				// Self term (m == 0) is masked out.
+				const T inv = (m == T{ 0 }) ? T{ 0 } : T{ 1 } / m;
+				sr += xr * inv;
+				si -= xi * inv;
+			}
+
+			// 1 - N * sum.
+			const T br = T{ 1 } - (nr * sr - ni * si);
+			const T bi = -(nr * si + ni * sr);
+			const T b = br * br + bi * bi;
+
+			if (b == T{ 0 })
+			{
+				stuck[i] = 1;
+				continue;
+			}
+
+			wr[i] = (nr * br + ni * bi) / b;
+			wi[i] = (ni * br - nr * bi) / b;
+		}
+
+		// Apply corrections together and freeze converged estimates.
+		converged = true;
+		for (std::size_t i = 0; i < n; i++)
+		{
+			if (done[i] != RootStop::none)
+				continue;
+
+			if (stuck[i])
+			{
+				// Move off the critical point by a small rotation-dependent offset.
+				const T delta = std::sqrt(std::numeric_limits<T>::epsilon()) * std::max(az[i], T{ 1 });
+				const T angle = T(0.4) + T(i);
+				re[i] += delta * std::cos(angle);
+				im[i] += delta * std::sin(angle);
+				stuck[i] = 0;
+				converged = false;
+				continue;
+			}
+
+			re[i] -= wr[i];
+			im[i] -= wi[i];
+
+			const T step = std::sqrt(wr[i] * wr[i] + wi[i] * wi[i]);
+			const T size = std::sqrt(re[i] * re[i] + im[i] * im[i]);
+
+			if (step <= T(options.tolerance) * std::max(size, T{ 1 }))
+				done[i] = RootStop::step;
+			else
+				converged = false;
+		}
+	}
+
+	std::vector<std::complex<T>> result(zeros, std::complex<T>());
+	for (std::size_t i = 0; i < n; i++)
+		result.emplace_back(re[i], im[i]);
+
+	if (report)
+	{
+		report->iterations = iteration;
+		report->converged = converged;
+		report->residuals.assign(zeros, 0.);
+		report->stops.assign(zeros, RootStop::residual);
+		report->stops.insert(report->stops.end(), done.begin(), done.end());
+
+		// Backward error of each nonzero root against the monic coefficients.
+		for (std::size_t i = 0; i < n; i++)
+		{
+			const std::complex<T> z(re[i], im[i]);
+			std::complex<T> value{ T{ 0 } };
+			T scale{ 0 };
+
+			for (std::size_t j = n + 1; j-- > 0; )
+			{
+				value = value * z + a[j];
+				scale = scale * std::abs(z) + std::abs(a[j]);
+			}
+
+			report->residuals.push_back(double(std::abs(value) / scale));
+		}
+	}
+
+	return result;
+}
+
+// Find all roots of many polynomials, solving them in parallel.
+template<typename T>
+std::vector<std::vector<std::complex<T>>> roots(const std::vector<Polynomial<T>>& polynomials, std::vector<RootReport>* reports = nullptr,
+	const RootOptions& options = RootOptions(), unsigned threads = 0)
+{
+	std::vector<std::vector<std::complex<T>>> result(polynomials.size());
+
+	if (reports)
+		reports->assign(polynomials.size(), RootReport());
+
+	// Default to one worker per hardware thread.
+	if (threads == 0)
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	threads = static_cast<unsigned>(std::min<std::size_t>(threads, polynomials.size()));
+
+	// Workers claim polynomials one at a time from a shared index.
+	std::atomic<std::size_t> next{ 0 };
+	std::vector<std::exception_ptr> errors(polynomials.size());
+	auto worker = [&]()
+	{
+		for (std::size_t i = next++; i < polynomials.size(); i = next++)
+		{
+			try
+			{
+				result[i] = roots(polynomials[i], reports ? &(*reports)[i] : nullptr, options);
+			}
+			catch (...)
+			{
+				errors[i] = std::current_exception();
+			}
+		}
+	};
+
+	std::vector<std::thread> pool;
+	for (unsigned i = 1; i < threads; i++)
+		pool.emplace_back(worker);
+	worker();
+	for (auto& t : pool)
+		t.join();
+
+	// Rethrow the first failure on the calling thread.
+	for (auto& e : errors)
+		if (e)
+			std::rethrow_exception(e);
+
+	return result;
+}
+
+// Real root interval, endpoints are dyadic points between the search bounds.
+struct RootInterval
+{
+	// Interval endpoints, equal when the root is known exactly.
+	double lower = 0.;
+	double upper = 0.;
+	// Number of roots in the interval, one when isolated. More than one is
+	// an upper bound, with multiplicity, for a cluster that could not be
+	// separated: at maxDepth, or for floating point coefficients where the
+	// signs needed to separate the roots are lost in rounding (a multiple
+	// root of the intended polynomial, for instance).
+	unsigned count = 0;
+};
+
+namespace detail
+{
+	// Remove common factor of the coefficients, keeping their signs.
+	//
+	// Integer coefficients are divided by their gcd, floating point ones are
+	// scaled by a power of two so the largest is near one (exact), along
+	// with their error bounds if given.
+	template<typename T>
+	void removeContent(std::vector<T>& c, std::vector<T>* errors = nullptr)
+	{
+		if constexpr (std::is_floating_point<T>::value)
+		{
+			T largest{ 0 };
+			for (auto& x : c)
+				largest = std::max(largest, std::abs(x));
+
+			if (largest == T{ 0 })
+				return;
+
+			int exponent;
+			std::frexp(largest, &exponent);
+			for (auto& x : c)
+				x = std::ldexp(x, -exponent);
+			if (errors)
+				for (auto& x : *errors)
+					x = std::ldexp(x, -exponent);
+		}
+		else
+		{
+			T g{ 0 };
+			for (auto& x : c)
+			{
+				T y = x < T{ 0 } ? -x : x;
+				while (y != T{ 0 })
+				{
+					T r = g % y;
+					g = y;
+					y = r;
+				}
+			}
+
+			if (g > T{ 1 })
+				for (auto& x : c)
+					x = x / g;
+		}
+	}
+
+	// Sign variations in a coefficient sequence known to within errors
+	// (empty when exact). A coefficient within its error of zero counts as
+	// either sign, so the result is the most variations any sequence within
+	// the errors can have. Sets uncertain if any sign is unknown, and known
+	// to the number of non-zero coefficients with a known sign.
+	template<typename T>
+	unsigned signVariations(const std::vector<T>& c, const std::vector<T>& errors, bool& uncertain, std::size_t& known)
+	{
+		// Most variations so far ending on a negative or positive coefficient,
+		// or with no signed coefficient yet; -1 where impossible.
+		long none = 0, negative = -1, positive = -1;
+
+		uncertain = false;
+		known = 0;
+
+		for (std::size_t i = 0; i < c.size(); i++)
+		{
+			const T x = c[i];
+			const long afterPositive = positive < 0 ? -1 : positive + 1, afterNegative = negative < 0 ? -1 : negative + 1;
+
+			if (!errors.empty() && errors[i] != T{ 0 } && (x < T{ 0 } ? -x : x) <= errors[i])
+			{
+				// Either sign, or zero.
+				uncertain = true;
+				const long n = std::max({ none, negative, afterPositive });
+				positive = std::max({ none, positive, afterNegative });
+				negative = n;
+			}
+			else if (x != T{ 0 })
+			{
+				known++;
+				if (x < T{ 0 })
+				{
+					negative = std::max({ none, negative, afterPositive });
+					positive = -1;
+				}
+				else
+				{
+					positive = std::max({ none, positive, afterNegative });
+					negative = -1;
+				}
+				none = -1;
+			}
+		}
+
+		return static_cast<unsigned>(std::max({ none, negative, positive }));
+	}
+
+	// Coefficients of p(x + a).
+	template<typename T>
+	std::vector<T> shifted(const std::vector<T>& c, const T a)
+	{
+		std::vector<T> result = taylorShift(Polynomial<T>::fromDense(c), a).toDense();
+		result.resize(c.size(), T{ 0 });
+		return result;
+	}
+
+	// Replace c by the coefficients of p(x + a), updating error bounds.
+	//
+	// Floating point uses repeated synthetic division: the rounding error
+	// of each result is below gamma times the same computation applied to
+	// |c| and |a|, and incoming errors propagate the same way.
+	template<typename T>
+	void shift(std::vector<T>& c, std::vector<T>& errors, const T a)
+	{
+		if constexpr (std::is_floating_point<T>::value)
+		{
+			const std::size_t n = c.size() - 1;
+			const T b = std::abs(a);
+			const T gamma = T(2 * n + 2) * std::numeric_limits<T>::epsilon();
+			std::vector<T> m(c.size());
+
+			for (std::size_t i = 0; i <= n; i++)
+				m[i] = std::abs(c[i]);
+
+			for (std::size_t i = 0; i < n; i++)
+				for (std::size_t j = n; j-- > i; )
+				{
+					c[j] += a * c[j + 1];
+					m[j] += b * m[j + 1];
+					errors[j] += b * errors[j + 1];
+				}
+
+			// Bounds are sums of non-negative terms, inflated for their own rounding.
+			for (std::size_t i = 0; i <= n; i++)
+				errors[i] = (errors[i] + gamma * m[i]) * (T{ 1 } + gamma);
+		}
+		else
+			c = shifted(c, a);
+	}
+
+	// Replace q(x) by 2^n q(x / 2), exactly.
+	template<typename T>
+	void halve(std::vector<T>& q, std::vector<T>& errors)
+	{
+		const std::size_t n = q.size() - 1;
+
+		if constexpr (std::is_floating_point<T>::value)
+		{
+			for (std::size_t i = 0; i <= n; i++)
+			{
+				q[i] = std::ldexp(q[i], int(n - i));
+				errors[i] = std::ldexp(errors[i], int(n - i));
+			}
+		}
+		else
+		{
+			T power{ 1 };
+			for (std::size_t i = n + 1; i-- > 0; )
+			{
+				q[i] = q[i] * power;
+				power = power * T{ 2 };
+			}
+		}
+	}
+
+	// Upper bound on roots in (0, 1), from Descartes' rule on (x + 1)^n q(1 / (x + 1)).
+	template<typename T>
+	unsigned descartesBound(const std::vector<T>& q, const std::vector<T>& errors, bool& uncertain, std::size_t& known)
+	{
+		std::vector<T> r(q.rbegin(), q.rend()), e(errors.rbegin(), errors.rend());
+		shift(r, e, T{ 1 });
+		return signVariations(r, e, uncertain, known);
+	}
+
+	// Sign of p(x): -1, 0 or 1.
+	template<typename T>
+	int signAt(const std::vector<T>& c, const T x)
+	{
+		T value{ 0 };
+		for (std::size_t i = c.size(); i-- > 0; )
+			value = value * x + c[i];
+
+		return (value > T{ 0 }) - (value < T{ 0 });
+	}
+
+	// Value of x as m 2^exponent with integer m, exactly.
+	template<typename T>
+	BigInt dyadic(const T x, int& exponent)
+	{
+		exponent = 0;
+
+		if constexpr (std::is_floating_point<T>::value)
+		{
+			// Mantissa bits, 30 at a time.
+			T m = std::frexp(std::abs(x), &exponent);
+			BigInt result;
+
+			while (m != T{ 0 })
+			{
+				m = std::ldexp(m, 30);
+				const T digit = std::floor(m);
+				result = result * BigInt(1 << 30) + BigInt(static_cast<long long>(digit));
+				m -= digit;
+				exponent -= 30;
+			}
+
+			return x < T{ 0 } ? -result : result;
+		}
+		else if constexpr (std::is_same<T, BigInt>::value)
+			return x;
+		else
+			return BigInt(static_cast<long long>(x));
+	}
+
+	// Integer coefficients, a positive multiple of c by a power of two.
+	template<typename T>
+	std::vector<BigInt> exactIntegers(const std::vector<T>& c)
+	{
+		std::vector<BigInt> result(c.size());
+		std::vector<int> exponents(c.size());
+		int lowest = 0;
+
+		for (std::size_t i = 0; i < c.size(); i++)
+		{
+			result[i] = dyadic(c[i], exponents[i]);
+			if (result[i])
+				lowest = std::min(lowest, exponents[i]);
+		}
+
+		for (std::size_t i = 0; i < c.size(); i++)
+			if (result[i] && exponents[i] != lowest)
+				result[i] *= pow(BigInt(2), unsigned(exponents[i] - lowest));
+
+		return result;
+	}
+
+	// Integer coefficients back as T, a positive multiple of c. Floating
+	// point results are rounded and scaled so the largest is near one;
+	// fixed width integers throw if a coefficient does not fit.
+	template<typename T>
+	std::vector<T> fromExactIntegers(const std::vector<BigInt>& c)
+	{
+		std::vector<T> result;
+
+		if constexpr (std::is_floating_point<T>::value)
+		{
+			std::size_t bits = 0;
+			for (auto& x : c)
+				bits = std::max(bits, x.bitLength());
+
+			// Leading 64 bits of each coefficient, then the common scale.
+			for (auto& x : c)
+			{
+				const std::size_t drop = x.bitLength() > 64 ? x.bitLength() - 64 : 0;
+				result.push_back(std::ldexp(T(double(drop ? x / pow(BigInt(2), unsigned(drop)) : x)), int(drop) - int(bits)));
+			}
+		}
+		else if constexpr (std::is_same<T, BigInt>::value)
+			result = c;
+		else
+		{
+			for (auto& x : c)
+			{
+				if (x.bitLength() > std::size_t(std::numeric_limits<T>::digits))
+					throw std::overflow_error("Coefficient does not fit in integer type");
+				result.push_back(T(static_cast<long long>(x)));
+			}
+		}
+
+		return result;
+	}
+
+	// Sign of p(x), exactly: -1, 0 or 1.
+	template<typename T>
+	int exactSignAt(const std::vector<BigInt>& c, const T x)
+	{
+		int exponent;
+		BigInt m = dyadic(x, exponent);
+
+		// 2^(-exponent n) p(m 2^exponent) by Horner's rule, all integers.
+		BigInt d(1);
+		if (exponent > 0)
+			m *= pow(BigInt(2), unsigned(exponent));
+		else if (exponent < 0)
+			d = pow(BigInt(2), unsigned(-exponent));
+
+		BigInt value = c.back(), scale(1);
+		for (std::size_t i = c.size() - 1; i-- > 0; )
+		{
+			scale *= d;
+			value = value * m + c[i] * scale;
+		}
+
+		return (value > BigInt()) - (value < BigInt());
+	}
+
+	// Sturm chain of s over the integers: s, s', then negated remainders.
+	//
+	// Remainders are pseudo-remainders scaled by a positive power of the
+	// divisor's leading coefficient, which keeps the signs a Sturm sequence
+	// needs while staying exact. Each remainder has its content removed to
+	// limit coefficient growth.
+	inline std::vector<std::vector<BigInt>> sturmChain(const std::vector<BigInt>& s)
+	{
+		std::vector<std::vector<BigInt>> chain{ s };
+
+		// Derivative.
+		std::vector<BigInt> d;
+		for (std::size_t i = 1; i < s.size(); i++)
+			d.push_back(s[i] * BigInt(static_cast<long long>(i)));
+		if (!d.empty())
+			chain.push_back(d);
+
+		while (chain.back().size() > 1)
+		{
+			std::vector<BigInt> r = chain[chain.size() - 2];
+			const std::vector<BigInt>& divisor = chain.back();
+			const BigInt lead = divisor.back();
+
+			// Pseudo division: r scaled once by |lead|^(deg r - deg divisor + 1),
+			// after which every quotient coefficient r.back() / lead is exact.
+			if (r.size() >= divisor.size())
+			{
+				const BigInt scale = pow(abs(lead), static_cast<unsigned>(r.size() - divisor.size() + 1));
+				for (auto& x : r)
+					x *= scale;
+			}
+
+			while (r.size() >= divisor.size())
+			{
+				const std::size_t offset = r.size() - divisor.size();
+				const BigInt factor = r.back() / lead;
+
+				for (std::size_t i = 0; i < divisor.size(); i++)
+					r[offset + i] -= factor * divisor[i];
+				r.pop_back();
+
+				while (!r.empty() && !r.back())
+					r.pop_back();
+			}
+
+			if (r.empty())
+				break;
+
+			// Negated remainder, with content removed.
+			for (auto& x : r)
+				x = -x;
+			removeContent(r);
+			chain.push_back(r);
+		}
+
+		return chain;
+	}
+
+	// Isolate the real roots of p in [a, b], T floating point or BigInt.
+	template<typename T>
+	std::vector<RootInterval> isolateRoots(const Polynomial<T>& p, const T a, const T b, const unsigned maxDepth)
+	{
+		if (!(a < b))
+			throw std::domain_error("Empty root interval");
+
+		std::vector<T> q = p.toDense();
+		while (!q.empty() && q.back() == T{ 0 })
+			q.pop_back();
+
+		if (q.empty())
+			throw std::domain_error("Roots of zero polynomial");
+
+		// Rounding error bound of each coefficient, floating point only.
+		std::vector<T> errors;
+		if constexpr (std::is_floating_point<T>::value)
+			errors.assign(q.size(), T{ 0 });
+
+		const std::size_t degree = q.size() - 1;
+		std::vector<RootInterval> result;
+		const T w = b - a;
+		const double low = double(a), width = double(w);
+
+		// Map [a, b] onto [0, 1], q(a + (b - a) x).
+		shift(q, errors, a);
+		T scale{ 1 };
+		for (std::size_t i = 0; i < q.size(); i++)
+		{
+			q[i] = q[i] * scale;
+			if constexpr (std::is_floating_point<T>::value)
+			{
+				// The scale has i roundings, the product one more.
+				const T gamma = T(i + 2) * std::numeric_limits<T>::epsilon();
+				errors[i] = (errors[i] * scale + gamma * std::abs(q[i])) * (T{ 1 } + gamma);
+			}
+			scale = scale * w;
+		}
+		removeContent(q, &errors);
+
+		// Root at a is a factor of x.
+		if (q[0] == T{ 0 })
+		{
+			result.push_back({ low, low, 1 });
+			while (q[0] == T{ 0 })
+			{
+				q.erase(q.begin());
+				if (!errors.empty())
+					errors.erase(errors.begin());
+			}
+		}
+
+		// Root at b is a factor of (x - 1), divided out synthetically.
+		if (signAt(q, T{ 1 }) == 0)
+		{
+			result.push_back({ double(b), double(b), 1 });
+			do
+			{
+				for (std::size_t i = q.size() - 1; i-- > 0; )
+				{
+					q[i] += q[i + 1];
+					if constexpr (std::is_floating_point<T>::value)
+						errors[i] = (errors[i] + errors[i + 1] + std::abs(q[i]) * std::numeric_limits<T>::epsilon()) * (T{ 1 } + std::numeric_limits<T>::epsilon());
+				}
+				q.erase(q.begin());
+				if (!errors.empty())
+					errors.erase(errors.begin());
+			} while (signAt(q, T{ 1 }) == 0);
+		}
+
+		// Pending subintervals [c / 2^k, (c + 1) / 2^k] with their transformed polynomials.
+		struct Node { std::vector<T> q, errors; unsigned long long c; unsigned k; };
+		std::vector<Node> pending;
+		pending.push_back({ std::move(q), std::move(errors), 0, 0 });
+
+		while (!pending.empty())
+		{
+			Node node = std::move(pending.back());
+			pending.pop_back();
+
+			bool uncertain = false;
+			std::size_t known = 0;
+			const unsigned count = node.q.size() > 1 ? descartesBound(node.q, node.errors, uncertain, known) : 0;
+
+			if (count == 0)
+				continue;
+
+			// Isolated, or out of depth, or every sign lost in rounding so
+			// bisection can make no more progress.
+			if ((count == 1 && !uncertain) || node.k >= maxDepth || known == 0)
+			{
+				result.push_back({ low + width * std::ldexp(double(node.c), -int(node.k)),
+					low + width * std::ldexp(double(node.c + 1), -int(node.k)), count });
+				continue;
+			}
+
+			// Left half, 2^n q(x / 2).
+			std::vector<T> left = node.q, leftErrors = node.errors;
+			halve(left, leftErrors);
+			removeContent(left, &leftErrors);
+
+			// Right half, left shifted by one.
+			std::vector<T> right = left, rightErrors = leftErrors;
+			shift(right, rightErrors, T{ 1 });
+
+			// Root exactly at the bisection point.
+			if (right[0] == T{ 0 })
+			{
+				const double middle = low + width * std::ldexp(double(2 * node.c + 1), -int(node.k + 1));
+				result.push_back({ middle, middle, 1 });
+				while (right[0] == T{ 0 })
+				{
+					right.erase(right.begin());
+					if (!rightErrors.empty())
+						rightErrors.erase(rightErrors.begin());
+				}
+			}
+
+			pending.push_back({ std::move(right), std::move(rightErrors), 2 * node.c + 1, node.k + 1 });
+			pending.push_back({ std::move(left), std::move(leftErrors), 2 * node.c, node.k + 1 });
+		}
+
+		std::sort(result.begin(), result.end(), [](const RootInterval& x, const RootInterval& y) { return x.lower < y.lower; });
+
+		// Clusters absorb the intervals they touch, counts added up to at most
+		// the degree. Rounding can leave exact zeros among a cluster's roots.
+		std::vector<RootInterval> merged;
+		for (auto& r : result)
+		{
+			if (!merged.empty() && (merged.back().count > 1 || r.count > 1) && r.lower <= merged.back().upper)
+			{
+				merged.back().upper = std::max(merged.back().upper, r.upper);
+				merged.back().count = unsigned(std::min<std::size_t>(merged.back().count + r.count, degree));
+			}
+			else
+				merged.push_back(r);
+		}
+
+		return merged;
+	}
+}
+
+// Isolate the real roots of p in [a, b] by Descartes' rule with bisection.
+//
+// [a, b] is mapped onto [0, 1]; an interval with no sign variation in its
+// Descartes transform holds no root, one with a single variation holds
+// exactly one, and anything else is halved: q(x) -> 2^n q(x / 2) for the
+// left half and its Taylor shift by one for the right half (the VCA method).
+// Roots falling on a, b or a bisection point are returned as zero width
+// intervals. Results are sorted by lower endpoint.
+//
+// Integer coefficients are exact; fixed width integers are converted to
+// BigInt since the transformed coefficients outgrow them. Floating point
+// coefficients carry a running bound on their rounding errors through
+// every transform, and a coefficient within its bound of zero counts as
+// either sign, so roots are never lost. Where the signs run out before
+// roots separate, the interval is returned as a cluster.
+//
+// Endpoints are doubles, so maxDepth is at most 52 halvings of [a, b];
+// deeper ones could not be told apart.
+template<typename T>
+std::vector<RootInterval> realRootIntervals(const Polynomial<T>& p, const T a, const T b, const unsigned maxDepth = 52)
+{
+	if (maxDepth > 52)
+		throw std::domain_error("Root isolation depth above 52");
+
+	if constexpr (std::is_integral<T>::value)
+	{
+		Polynomial<BigInt> exact;
+		for (auto& t : p)
+			exact.setTerm(t.first, BigInt(static_cast<long long>(t.second)));
+
+		return detail::isolateRoots(exact, BigInt(static_cast<long long>(a)), BigInt(static_cast<long long>(b)), maxDepth);
+	}
+	else
+		return detail::isolateRoots(p, a, b, maxDepth);
+}
+
+// Sturm sequence of p: p, p', then negated remainders until zero.
+//
+// The sequence is computed exactly over the integers (floating point
+// coefficients are dyadic rationals, so scale to integers exactly), then
+// returned as T. Members are positive multiples of the exact ones:
+// floating point ones rounded with their largest coefficient near one,
+// fixed width integer ones throw overflow_error if they do not fit.
+template<typename T>
+std::vector<Polynomial<T>> sturmSequence(const Polynomial<T>& p)
+{
+	std::vector<T> s = p.toDense();
+	while (!s.empty() && s.back() == T{ 0 })
+		s.pop_back();
+
+	if (s.empty())
+		return std::vector<Polynomial<T>>();
+
+	std::vector<Polynomial<T>> result;
+	for (auto& c : detail::sturmChain(detail::exactIntegers(s)))
+		result.push_back(Polynomial<T>::fromDense(detail::fromExactIntegers<T>(c)));
+
+	return result;
+}
+
+// Count distinct real roots of p in (a, b] from its Sturm sequence.
+//
+// Exact for every coefficient type: the sequence and its signs at a and b
+// are computed over the integers, so floating point coefficients are
+// counted as the exact values they hold.
+template<typename T>
+unsigned sturmCount(const Polynomial<T>& p, const T a, const T b)
+{
+	if (!(a < b))
+		return 0;
+
+	std::vector<T> s = p.toDense();
+	while (!s.empty() && s.back() == T{ 0 })
+		s.pop_back();
+
+	if (s.empty())
+		return 0;
+
+	const std::vector<std::vector<BigInt>> chain = detail::sturmChain(detail::exactIntegers(s));
+
+	// Sign variations of the sequence at x, zeros skipped.
+	auto variations = [&chain](const T x)
+	{
+		unsigned count = 0;
+		int previous = 0;
+
+		for (auto& c : chain)
+		{
+			const int sign = detail::exactSignAt(c, x);
+			if (sign == 0)
+				continue;
+			if (previous && sign != previous)
+				count++;
+			previous = sign;
+		}
+
+		return count;
+	};
+
+	const unsigned va = variations(a), vb = variations(b);
+
+	return va > vb ? va - vb : 0;
+}
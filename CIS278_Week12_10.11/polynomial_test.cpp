@@ -24,12 +24,25 @@
 #ifndef NDEBUG
 
 #include <iostream>  // cout/endl
+#include <unordered_set>
+#include <cstdio>    // remove
+#include <fstream>   // ifstream
+#include <complex>
 
 // Visual Leak Detector.
 #include "C:\Program Files (x86)\Visual Leak Detector\include\vld.h"
 
 // Our polynomial class.
 #include "polynomial.h"
+#include "power_series.h"
+#include "polynomial_roots.h"
+#include "polynomial_cache.h"
+#include "chebyshev.h"
+#include "bigint.h"
+#include "polynomial_external.h"
+#include "polynomial_resultant.h"
+#include "rational_function.h"
+#include "multi_polynomial.h"
 
 #define BOOST_CONFIG_SUPPRESS_OUTDATED_MESSAGE
 #define BOOST_TEST_MODULE TestPolynomial
@@ -235,7 +248,7 @@ BOOST_AUTO_TEST_CASE(division_modulus)
 	BOOST_CHECK(answer2 == (a % b));
 
 	// Test division without remainder.
-	Polynomial<double> c({ { 2, 1. }, { 1, 2. }, { 0, 2. } });
+	Polynomial<double> c({ { 2, 1. }, { 1, 2. }, { 0, 1. } });
 	Polynomial<double> d({ { 1, 1 }, { 0, 1 } });
 	Polynomial<double> answer3({ { 1, 1. }, { 0, 1. } });
 	Polynomial<double> answer4({ { 0, 0. } });
@@ -295,6 +308,803 @@ BOOST_AUTO_TEST_CASE(unary_negate)
 	BOOST_CHECK(answer == -a);
 }
 
+BOOST_AUTO_TEST_CASE(dense_multiplication)
+{
+	// Dense operands above the Karatsuba cutoff, checked against schoolbook product.
+	Polynomial<int> a, b, answer;
+	for (unsigned i = 0; i <= 100; i++)
+		a.setTerm(i, int(i % 7) - 3);
+	for (unsigned i = 0; i <= 70; i++)
+		b.setTerm(i, int(i % 5) - 2);
+
+	for (unsigned i = 0; i <= 100; i++)
+		for (unsigned j = 0; j <= 70; j++)
+			answer.setTerm(i + j, (int(i % 7) - 3) * (int(j % 5) - 2));
+
+	BOOST_CHECK(answer == (a * b));
+	BOOST_CHECK(answer == (b * a));
+}
+
+BOOST_AUTO_TEST_CASE(composition)
+{
+	// Compose (x^2 + 1) with (x - 1) = x^2 - 2x + 2
+	Polynomial<int> a({ { 2, 1 }, { 0, 1 } });
+	Polynomial<int> b({ { 1, 1 }, { 0, -1 } });
+	Polynomial<int> answer1({ { 2, 1 }, { 1, -2 }, { 0, 2 } });
+	BOOST_CHECK(answer1 == compose(a, b));
+
+	// Compare against plain Horner's rule for a larger composition, in long
+	// long since the degree 60 coefficients overflow int.
+	Polynomial<long long> c, d({ { 3, 2 }, { 1, -1 }, { 0, 1 } }), answer2;
+	for (unsigned i = 0; i <= 20; i++)
+		c.setTerm(i, (long long)(i % 3) - 1);
+
+	for (unsigned i = 21; i-- > 0; )
+	{
+		Polynomial<long long> coefficient;
+		coefficient.setTerm(0, (long long)(i % 3) - 1);
+		answer2 *= d;
+		answer2 += coefficient;
+	}
+	BOOST_CHECK(answer2 == compose(c, d));
+
+	// Zero polynomial composes to zero.
+	Polynomial<long long> zero;
+	BOOST_CHECK(zero == compose(zero, d));
+}
+
+BOOST_AUTO_TEST_CASE(taylor_shift)
+{
+	// Shift (x^2 + 1) by 2 = x^2 + 4x + 5
+	Polynomial<double> a({ { 2, 1. }, { 0, 1. } });
+	Polynomial<double> answer1({ { 2, 1. }, { 1, 4. }, { 0, 5. } });
+	BOOST_CHECK(answer1 == taylorShift(a, 2.));
+
+	// Large enough to split, compared against composition with (x - 3).
+	// Degree 24 keeps every coefficient within long long.
+	Polynomial<long long> b;
+	for (unsigned i = 0; i <= 24; i++)
+		b.setTerm(i, (long long)(i % 4) - 1);
+	Polynomial<long long> c({ { 1, 1 }, { 0, -3 } });
+	BOOST_CHECK(compose(b, c) == taylorShift(b, -3LL));
+}
+
+BOOST_AUTO_TEST_CASE(power_series)
+{
+	// Short product matches the truncated full product, above the direct cutoff.
+	Polynomial<long long> a, b;
+	for (unsigned i = 0; i < 150; i++)
+	{
+		a.setTerm(i, (long long)(i % 7) - 3);
+		b.setTerm(i, (long long)(i % 5) - 2);
+	}
+	PowerSeries<long long> c(a, 100), d(b, 100);
+	PowerSeries<long long> answer1(a * b, 100);
+	BOOST_CHECK(answer1.toPolynomial() == (c * d).toPolynomial());
+
+	// Inverse of (1 - x) = 1 + x + x^2 + ...
+	PowerSeries<double> e(Polynomial<double>({ { 1, -1. }, { 0, 1. } }), 50);
+	PowerSeries<double> f = e.inverse();
+	BOOST_CHECK_EQUAL(f.getOrder(), 50);
+	for (std::size_t i = 0; i < 50; i++)
+		BOOST_CHECK_CLOSE(f[i], 1., 1e-9);
+
+	// exp(x) = sum x^k / k!
+	PowerSeries<double> g(Polynomial<double>({ { 1, 1. } }), 20);
+	PowerSeries<double> h = g.exp();
+	double factorial = 1.;
+	for (std::size_t i = 0; i < 20; i++)
+	{
+		BOOST_CHECK_CLOSE(h[i], 1. / factorial, 1e-6);
+		factorial *= double(i + 1);
+	}
+
+	// exp(log(p)) and sqrt(p)^2 round trip p.
+	PowerSeries<double> p(Polynomial<double>({ { 3, 0.125 }, { 2, -0.25 }, { 1, 0.5 }, { 0, 1. } }), 64);
+	PowerSeries<double> q = p.log().exp(), r = p.sqrt() * p.sqrt();
+	for (std::size_t i = 0; i < 64; i++)
+	{
+		BOOST_CHECK_SMALL(q[i] - p[i], 1e-12);
+		BOOST_CHECK_SMALL(r[i] - p[i], 1e-12);
+	}
+
+	// Invalid constant terms.
+	BOOST_CHECK_THROW(g.inverse(), std::domain_error);
+	BOOST_CHECK_THROW(g.log(), std::domain_error);
+	BOOST_CHECK_THROW(e.exp(), std::domain_error);
+}
+
+BOOST_AUTO_TEST_CASE(complex_roots)
+{
+	// (x - 1)(x + 2)(x^2 + 1) x = x^5 + x^4 - x^3 + x^2 - 2x
+	Polynomial<double> a({ { 5, 1. }, { 4, 1. }, { 3, -1. }, { 2, 1. }, { 1, -2. } });
+	RootReport report;
+	std::vector<std::complex<double>> r = roots(a, &report);
+
+	BOOST_CHECK(report.converged);
+	BOOST_CHECK_EQUAL(r.size(), 5);
+	BOOST_CHECK_EQUAL(report.residuals.size(), 5);
+
+	// Each expected root is found.
+	std::vector<std::complex<double>> answer{ { 0., 0. }, { 1., 0. }, { -2., 0. }, { 0., 1. }, { 0., -1. } };
+	for (auto& z : answer)
+	{
+		double nearest = 1.;
+		for (auto& w : r)
+			nearest = std::min(nearest, std::abs(z - w));
+		BOOST_CHECK_SMALL(nearest, 1e-10);
+	}
+	for (double residual : report.residuals)
+		BOOST_CHECK_SMALL(residual, 1e-13);
+
+	// Parallel solve of many polynomials, x^n - 1 has the n roots of unity.
+	std::vector<Polynomial<double>> b;
+	for (unsigned n = 1; n <= 40; n++)
+		b.push_back(Polynomial<double>({ { n, 1. }, { 0, -1. } }));
+
+	std::vector<RootReport> reports;
+	std::vector<std::vector<std::complex<double>>> s = roots(b, &reports, RootOptions(), 4);
+	for (unsigned n = 1; n <= 40; n++)
+	{
+		BOOST_CHECK(reports[n - 1].converged);
+		BOOST_CHECK_EQUAL(s[n - 1].size(), n);
+		for (auto& z : s[n - 1])
+			BOOST_CHECK_SMALL(std::abs(z) - 1., 1e-12);
+	}
+
+	// (x - 1)^4: steps stay large around a fourfold root, the backward error
+	// stop ends the iteration at the attainable accuracy of about eps^(1/4).
+	Polynomial<double> c({ { 4, 1. }, { 3, -4. }, { 2, 6. }, { 1, -4. }, { 0, 1. } });
+	r = roots(c, &report);
+	BOOST_CHECK(report.converged);
+	BOOST_CHECK_LT(report.iterations, RootOptions().maxIterations);
+	for (std::size_t i = 0; i < r.size(); i++)
+	{
+		BOOST_CHECK(report.stops[i] != RootStop::none);
+		BOOST_CHECK_SMALL(std::abs(r[i] - 1.), 1e-3);
+		BOOST_CHECK_SMALL(report.residuals[i], 1e-14);
+	}
+
+	// Zero polynomial has no roots.
+	Polynomial<double> zero;
+	BOOST_CHECK_THROW(roots(zero), std::domain_error);
+}
+
+BOOST_AUTO_TEST_CASE(real_roots)
+{
+	// (x - 1)(x - 2)(x + 3)(2x - 1) = 2x^4 - x^3 - 14x^2 + 19x - 6, roots on bisection points.
+	Polynomial<long long> a({ { 4, 2 }, { 3, -1 }, { 2, -14 }, { 1, 19 }, { 0, -6 } });
+	std::vector<RootInterval> r = realRootIntervals(a, -4LL, 4LL);
+	std::vector<double> answer{ -3., 0.5, 1., 2. };
+
+	BOOST_CHECK_EQUAL(r.size(), 4);
+	for (std::size_t i = 0; i < r.size() && i < answer.size(); i++)
+	{
+		BOOST_CHECK_EQUAL(r[i].count, 1);
+		BOOST_CHECK(r[i].lower <= answer[i] && answer[i] <= r[i].upper);
+	}
+
+	// Sturm counts, distinct roots in (a, b].
+	BOOST_CHECK_EQUAL(sturmCount(a, -4LL, 4LL), 4);
+	BOOST_CHECK_EQUAL(sturmCount(a, 0LL, 1LL), 2);
+	BOOST_CHECK_EQUAL(sturmCount(a, 1LL, 2LL), 1);
+	BOOST_CHECK_EQUAL(sturmCount(a, 2LL, 100LL), 0);
+
+	// Double root counts once, (x - 1)^2 (x + 1) = x^3 - x^2 - x + 1.
+	Polynomial<long long> b({ { 3, 1 }, { 2, -1 }, { 1, -1 }, { 0, 1 } });
+	BOOST_CHECK_EQUAL(sturmCount(b, -2LL, 2LL), 2);
+	BOOST_CHECK_EQUAL(sturmSequence(b).size(), 3);
+
+	// Floating point, (x - 1)(x - 2) ... (x - 10) on [0, 10.5].
+	Polynomial<double> c({ { 0, 1. } });
+	for (int i = 1; i <= 10; i++)
+		c *= Polynomial<double>({ { 1, 1. }, { 0, -double(i) } });
+
+	std::vector<RootInterval> s = realRootIntervals(c, 0., 10.5);
+	BOOST_CHECK_EQUAL(s.size(), 10);
+	for (std::size_t i = 0; i < s.size(); i++)
+	{
+		BOOST_CHECK_EQUAL(s[i].count, 1);
+		BOOST_CHECK(s[i].lower <= double(i + 1) && double(i + 1) <= s[i].upper);
+	}
+	BOOST_CHECK_EQUAL(sturmCount(c, 0., 10.5), 10);
+
+
+	// Wilkinson polynomials past degree 16 lose their Sturm signs in double
+	// remainders; the exact count still finds every root.
+	for (int n = 11; n <= 20; n++)
+	{
+		c *= Polynomial<double>({ { 1, 1. }, { 0, -double(n) } });
+		if (n >= 17)
+			BOOST_CHECK_EQUAL(sturmCount(c, 0., n + .5), unsigned(n));
+	}
+
+	// Double roots of rounded coefficients stay as one cluster. Exactly, the
+	// rounded (x - r)^2 has a complex pair, so the Sturm count is zero.
+	for (double root : { .3, 1. / 3. })
+	{
+		Polynomial<double> e({ { 1, 1. }, { 0, -root } });
+		e *= e;
+		std::vector<RootInterval> t = realRootIntervals(e, -3., 5.);
+		BOOST_CHECK_EQUAL(t.size(), 1);
+		if (!t.empty())
+		{
+			BOOST_CHECK_EQUAL(t[0].count, 2);
+			BOOST_CHECK(t[0].lower <= root && root <= t[0].upper);
+			BOOST_CHECK_LT(t[0].upper - t[0].lower, 1e-5);
+		}
+		BOOST_CHECK_EQUAL(sturmCount(e, -3., 5.), 0);
+	}
+
+	// Fixed width integers are isolated in BigInt, the transformed
+	// coefficients of (x - 1) ... (x - 12) overflow long long.
+	Polynomial<long long> f({ { 0, 1 } });
+	for (long long k = 1; k <= 12; k++)
+		f *= Polynomial<long long>({ { 1, 1 }, { 0, -k } });
+	std::vector<RootInterval> u = realRootIntervals(f, 0LL, 13LL);
+	BOOST_CHECK_EQUAL(u.size(), 12);
+	for (std::size_t i = 0; i < u.size(); i++)
+	{
+		BOOST_CHECK_EQUAL(u[i].count, 1);
+		BOOST_CHECK(u[i].lower <= double(i + 1) && double(i + 1) <= u[i].upper);
+	}
+	BOOST_CHECK_EQUAL(sturmCount(f, 0LL, 13LL), 12);
+
+	// No roots.
+	Polynomial<double> d({ { 2, 1. }, { 0, 1. } });
+	BOOST_CHECK(realRootIntervals(d, -10., 10.).empty());
+	BOOST_CHECK_EQUAL(sturmCount(d, -10., 10.), 0);
+
+	// Depths past the double mantissa would give coincident endpoints.
+	BOOST_CHECK_THROW(realRootIntervals(d, -10., 10., 53), std::domain_error);
+	BOOST_CHECK_THROW(realRootIntervals(f, 0LL, 13LL, 64), std::domain_error);
+}
+
+BOOST_AUTO_TEST_CASE(sparse_multiplication)
+{
+	// (x^1000 + x^3 + 1) * (x^500 - x^3 + 2) = x^1500 - x^1003 + 2x^1000 + x^503 + x^500 - x^6 + x^3 + 2
+	Polynomial<int> a({ { 1000, 1 }, { 3, 1 }, { 0, 1 } });
+	Polynomial<int> b({ { 500, 1 }, { 3, -1 }, { 0, 2 } });
+	Polynomial<int> answer({ { 1500, 1 }, { 1003, -1 }, { 1000, 2 }, { 503, 1 }, { 500, 1 }, { 6, -1 }, { 3, 1 }, { 0, 2 } });
+	BOOST_CHECK(answer == (a * b));
+
+	// Streamed terms are in ascending exponent order with like terms combined.
+	Polynomial<int> c({ { 1, 1 }, { 0, 1 } });
+	Polynomial<int> d({ { 1, 1 }, { 0, -1 } });
+	std::vector<std::pair<unsigned, int>> terms;
+	Polynomial<int>::multiplyTerms(c, d, [&terms](unsigned exponent, int coefficient) { terms.emplace_back(exponent, coefficient); });
+	std::vector<std::pair<unsigned, int>> answer2{ { 0, -1 }, { 2, 1 } };
+	BOOST_CHECK(terms == answer2);
+
+	// Product with zero polynomial.
+	Polynomial<int> zero;
+	BOOST_CHECK(zero == (a * zero));
+}
+
+BOOST_AUTO_TEST_CASE(tabulation)
+{
+	// x^3 - 2x + 1 on x = -5, -3, -1, ... matches Horner evaluation exactly.
+	Polynomial<long long> a({ { 3, 1 }, { 1, -2 }, { 0, 1 } });
+	std::vector<long long> values(100);
+	a.tabulate(-5LL, 2LL, values.size(), values.begin());
+	for (std::size_t i = 0; i < values.size(); i++)
+	{
+		const long long x = -5 + 2 * (long long)i;
+		BOOST_CHECK_EQUAL(values[i], x * x * x - 2 * x + 1);
+	}
+
+	// Degree 14 int: differences reach 14!, past int, though the values fit.
+	Polynomial<int> c({ { 14, 1 }, { 13, -1 }, { 1, 7 }, { 0, 3 } });
+	std::vector<int> small(9);
+	c.tabulate(-4, 1, small.size(), small.begin(), 3);
+	for (std::size_t i = 0; i < small.size(); i++)
+	{
+		const long long x = -4 + (long long)i, x13 = x * x * x * x * x * x * x * x * x * x * x * x * x;
+		BOOST_CHECK_EQUAL(small[i], x13 * x - x13 + 7 * x + 3);
+	}
+
+	// Floating point, reseeded and split over threads.
+	Polynomial<double> b({ { 4, 0.5 }, { 2, -3. }, { 1, 0.25 }, { 0, 2. } });
+	std::vector<double> grid(10000);
+	b.tabulate(-1., 0.0002, grid.size(), grid.data(), 256, 4);
+	for (std::size_t i = 0; i < grid.size(); i++)
+	{
+		const double x = -1. + 0.0002 * double(i);
+		BOOST_CHECK_SMALL(grid[i] - (0.5 * x * x * x * x - 3. * x * x + 0.25 * x + 2.), 1e-9);
+	}
+
+	// Zero polynomial tabulates zeros.
+	Polynomial<double> zero;
+	std::vector<double> zeros(10, 1.);
+	zero.tabulate(0., 1., zeros.size(), zeros.begin());
+	for (double z : zeros)
+		BOOST_CHECK_EQUAL(z, 0.);
+}
+
+BOOST_AUTO_TEST_CASE(copy_on_write)
+{
+	// Copies share terms until one is modified.
+	const Polynomial<double> a({ { 4, 7. }, { 2, -1. }, { 0, 3. } });
+	Polynomial<double> b = a;
+	BOOST_CHECK(a == b);
+	b.setTerm(1, 2.);
+	b[4] = 1.;
+	Polynomial<double> answer1({ { 4, 7. }, { 2, -1. }, { 0, 3. } });
+	Polynomial<double> answer2({ { 4, 1. }, { 2, -1. }, { 1, 2. }, { 0, 3. } });
+	BOOST_CHECK(a == answer1);
+	BOOST_CHECK(b == answer2);
+
+	// Negation leaves the operand alone.
+	Polynomial<double> answer3({ { 4, -7. }, { 2, 1. }, { 0, -3. } });
+	BOOST_CHECK(answer3 == -a);
+	BOOST_CHECK(answer1 == a);
+
+	// Read functions on a const polynomial, null terms ignored.
+	Polynomial<double> c({ { 5, 0. }, { 1, 2. } });
+	const Polynomial<double> d = c;
+	double coefficient = 0.;
+	BOOST_CHECK(d.getTerm(1, coefficient) && coefficient == 2.);
+	BOOST_CHECK_EQUAL(d.getDegree(), 1);
+	BOOST_CHECK_EQUAL(d.evaluate(3.), 6.);
+	BOOST_CHECK(d.differentiate() == Polynomial<double>({ { 0, 2. } }));
+	BOOST_CHECK(d == Polynomial<double>({ { 1, 2. } }));
+
+	// A reference from operator[] keeps writing to its own polynomial only.
+	Polynomial<int> e({ { 1, 2 }, { 0, 1 } });
+	int& r = e[0];
+	Polynomial<int> f = e, g;
+	g = e;
+	r = 42;
+	BOOST_CHECK(f == Polynomial<int>({ { 1, 2 }, { 0, 1 } }));
+	BOOST_CHECK(g == Polynomial<int>({ { 1, 2 }, { 0, 1 } }));
+	BOOST_CHECK(e == Polynomial<int>({ { 1, 2 }, { 0, 42 } }));
+
+	// Writes through the reference are seen by fingerprint and equality.
+	Polynomial<int> x({ { 1, 3 } }), y({ { 1, 5 } });
+	int& s = x[1];
+	BOOST_CHECK(x.fingerprint() != y.fingerprint());
+	s = 5;
+	BOOST_CHECK_EQUAL(x.fingerprint(), y.fingerprint());
+	BOOST_CHECK(x == y);
+
+	// Quotients and remainders stay shareable, copies use the same terms.
+	const Polynomial<double> n({ { 3, 2. }, { 1, -1. }, { 0, 5. } }), m({ { 1, 1. }, { 0, -2. } });
+	const Polynomial<double> q = n / m, rem = n % m, qc = q, remc = rem;
+	BOOST_CHECK(q == Polynomial<double>({ { 2, 2. }, { 1, 4. }, { 0, 7. } }));
+	BOOST_CHECK(rem == Polynomial<double>({ { 0, 19. } }));
+	BOOST_CHECK(&q.begin()->second == &qc.begin()->second);
+	BOOST_CHECK(&rem.begin()->second == &remc.begin()->second);
+
+	// Concurrent readers of one polynomial.
+	std::vector<double> values(4);
+	std::vector<std::thread> readers;
+	for (std::size_t i = 0; i < values.size(); i++)
+		readers.emplace_back([&a, &values, i]()
+		{
+			Polynomial<double> copy = a;
+			values[i] = copy.evaluate(1.) + double(a.getDegree()) + (a * a).evaluate(1.);
+		});
+	for (auto& t : readers)
+		t.join();
+	for (double v : values)
+		BOOST_CHECK_EQUAL(v, 9. + 4. + 81.);
+}
+
+// Integers modulo 7, a coefficient type without std::hash.
+struct Mod7
+{
+	int v;
+	Mod7(const int x = 0) : v(((x % 7) + 7) % 7) { }
+	Mod7 operator+ (const Mod7& r) const { return Mod7(v + r.v); }
+	Mod7 operator- (const Mod7& r) const { return Mod7(v - r.v); }
+	Mod7 operator* (const Mod7& r) const { return Mod7(v * r.v); }
+	Mod7 operator- () const { return Mod7(-v); }
+	Mod7& operator+= (const Mod7& r) { return *this = *this + r; }
+	Mod7& operator-= (const Mod7& r) { return *this = *this - r; }
+	Mod7& operator*= (const Mod7& r) { return *this = *this * r; }
+	bool operator== (const Mod7& r) const { return v == r.v; }
+	bool operator!= (const Mod7& r) const { return v != r.v; }
+};
+
+BOOST_AUTO_TEST_CASE(unhashable_coefficients)
+{
+	// Coefficient types without std::hash build and multiply; only
+	// fingerprint and std::hash<Polynomial> need a hashable type.
+	typedef std::complex<double> Complex;
+	Polynomial<Complex> a({ { 1, Complex(0., 1.) }, { 0, Complex(1., 0.) } });
+	a.setTerm(2, Complex(2., 0.));
+	Polynomial<Complex> b = a * a;
+	BOOST_CHECK(b == Polynomial<Complex>({ { 4, Complex(4., 0.) }, { 3, Complex(0., 4.) }, { 2, Complex(3., 0.) }, { 1, Complex(0., 2.) }, { 0, Complex(1., 0.) } }));
+	BOOST_CHECK_EQUAL(b.evaluate(Complex(1., 0.)), a.evaluate(Complex(1., 0.)) * a.evaluate(Complex(1., 0.)));
+
+	// (x + 3)^2 = x^2 + 6x + 9 = x^2 - x + 2 modulo 7.
+	Polynomial<Mod7> c({ { 1, Mod7(1) }, { 0, Mod7(3) } });
+	c.setTerm(0, Mod7(0));
+	BOOST_CHECK(c * c == Polynomial<Mod7>({ { 2, Mod7(1) }, { 1, Mod7(-1) }, { 0, Mod7(2) } }));
+}
+
+BOOST_AUTO_TEST_CASE(fingerprint_cache)
+{
+	// Equal polynomials have equal fingerprints, however they were built.
+	Polynomial<int> a({ { 4, 7 }, { 2, -1 }, { 0, 3 } });
+	Polynomial<int> b;
+	b.fingerprint();
+	b.setTerm(0, 3);
+	b.setTerm(2, -1);
+	b.setTerm(4, 5);
+	b.setTerm(4, 2);
+	b.setTerm(1, 4);
+	b.setTerm(1, -4);
+	BOOST_CHECK_EQUAL(a.fingerprint(), b.fingerprint());
+	BOOST_CHECK(a == b);
+
+	// Incremental update matches a fresh computation.
+	Polynomial<int> c = b;
+	c[3] = 1;
+	b.setTerm(3, 1);
+	BOOST_CHECK_EQUAL(b.fingerprint(), c.fingerprint());
+	BOOST_CHECK(a.fingerprint() != b.fingerprint());
+	BOOST_CHECK(a != b);
+	BOOST_CHECK_EQUAL(Polynomial<int>().fingerprint(), 0);
+
+	// Hash container.
+	std::unordered_set<Polynomial<int>> set{ a, b, c };
+	BOOST_CHECK_EQUAL(set.size(), 2);
+
+	// Memoized results, multiplication shared across operand order.
+	PolynomialCache<double> cache(2);
+	Polynomial<double> d({ { 3, 1. }, { 2, -2. }, { 0, -4. } });
+	Polynomial<double> e({ { 1, 1. }, { 0, -3. } });
+	BOOST_CHECK(cache.multiply(d, e) == d * e);
+	BOOST_CHECK(cache.multiply(e, d) == d * e);
+	BOOST_CHECK(cache.divide(d, e) == d / e);
+	BOOST_CHECK(cache.modulus(d, e) == d % e);
+	BOOST_CHECK_EQUAL(cache.hits(), 1);
+	BOOST_CHECK_EQUAL(cache.misses(), 3);
+
+	// Least recently used entry (the product) was evicted.
+	BOOST_CHECK_EQUAL(cache.size(), 2);
+	BOOST_CHECK(cache.divide(d, e) == d / e);
+	BOOST_CHECK(cache.multiply(d, e) == d * e);
+	BOOST_CHECK_EQUAL(cache.hits(), 2);
+	BOOST_CHECK_EQUAL(cache.misses(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(chebyshev)
+{
+	// 4x^3 - 3x = T_3, 2x^2 - 1 = T_2.
+	Polynomial<double> a({ { 3, 4. }, { 1, -3. } });
+	ChebyshevPolynomial<double> t3(a);
+	BOOST_CHECK_EQUAL(t3.getDegree(), 3);
+	BOOST_CHECK_CLOSE(t3[3], 1., 1e-12);
+	BOOST_CHECK_SMALL(t3[1], 1e-12);
+
+	// T_2 T_3 = (T_5 + T_1) / 2.
+	ChebyshevPolynomial<double> t2(std::vector<double>{ 0., 0., 1. });
+	ChebyshevPolynomial<double> product = t2 * t3;
+	BOOST_CHECK_CLOSE(product[5], .5, 1e-12);
+	BOOST_CHECK_CLOSE(product[1], .5, 1e-12);
+	BOOST_CHECK_SMALL(product[3], 1e-12);
+
+	// Clenshaw agrees with Horner in the monomial basis.
+	Polynomial<double> b({ { 5, .5 }, { 4, -1. }, { 2, 3. }, { 0, -2. } });
+	ChebyshevPolynomial<double> c(b);
+	std::vector<double> x, y(21);
+	for (int i = 0; i <= 20; i++)
+		x.push_back(-1. + i / 10.);
+	c.evaluate(x.data(), y.data(), x.size());
+	for (std::size_t i = 0; i < x.size(); i++)
+	{
+		BOOST_CHECK_SMALL(c.evaluate(x[i]) - b.evaluate(x[i]), 1e-12);
+		BOOST_CHECK_EQUAL(y[i], c.evaluate(x[i]));
+	}
+
+	// Round trip through both bases, large enough for the fast paths (the
+	// monomial coefficients of T_n grow like 2^n, so keep the degree modest).
+	Polynomial<double> d;
+	for (unsigned i = 0; i < 40; i++)
+		d.setTerm(i, ((i * 37) % 11) / 11. - .5);
+	Polynomial<double> e = ChebyshevPolynomial<double>(d).toPolynomial();
+	for (unsigned i = 0; i < 40; i++)
+		BOOST_CHECK_SMALL(e[i] - d[i], 1e-9);
+
+	// DCT product matches the monomial product.
+	ChebyshevPolynomial<double> f(d), g(d * d);
+	ChebyshevPolynomial<double> h = f * f;
+	for (std::size_t k = 0; k <= 78; k++)
+		BOOST_CHECK_SMALL(h[k] - g[k], 1e-9);
+	for (double z : { -1., -.3, .4, 1. })
+		BOOST_CHECK_SMALL(h.evaluate(z) - d.evaluate(z) * d.evaluate(z), 1e-9);
+
+	// Interpolation of exp converges to machine precision by degree 16.
+	ChebyshevPolynomial<double> ex = ChebyshevPolynomial<double>::interpolate([](double z) { return std::exp(z); }, 16);
+	for (double z : { -1., -.5, 0., .7, 1. })
+		BOOST_CHECK_CLOSE(ex.evaluate(z), std::exp(z), 1e-12);
+
+	// Any n, not only powers of two: degree n reproduced with n + 1 terms.
+	for (std::size_t n : { 1, 5, 6, 11 })
+	{
+		ChebyshevPolynomial<double> r = ChebyshevPolynomial<double>::interpolate([n](double z) { return std::pow(z, double(n)); }, n);
+		BOOST_CHECK_EQUAL(r.getDegree(), n);
+		for (double z : { -1., -.3, .4, 1. })
+			BOOST_CHECK_SMALL(r.evaluate(z) - std::pow(z, double(n)), 1e-12);
+	}
+
+	// Streaming leaves the caller's format flags alone.
+	std::stringstream ss;
+	const std::ios_base::fmtflags flags = ss.flags();
+	const std::streamsize precision = ss.precision();
+	ss << ChebyshevPolynomial<double>({ 1.5, 0., -2. });
+	BOOST_CHECK_EQUAL(ss.str(), "-2.0T_2 + 1.5T_0");
+	BOOST_CHECK(ss.flags() == flags);
+	BOOST_CHECK_EQUAL(ss.precision(), precision);
+}
+
+BOOST_AUTO_TEST_CASE(big_integer)
+{
+	// Arithmetic past 64 bits, truncating division like int.
+	BigInt a("-123456789012345678901234567890"), b(987654321);
+	BOOST_CHECK_EQUAL((a * b).toString(), "-121932631124828532112482853211126352690");
+	BOOST_CHECK_EQUAL((a * b / b), a);
+	BOOST_CHECK_EQUAL((a / b).toString(), "-124999998873437499901");
+	BOOST_CHECK_EQUAL((a % b).toString(), "-574845669");
+	BOOST_CHECK_EQUAL(pow(BigInt(2), 100).toString(), "1267650600228229401496703205376");
+	BOOST_CHECK(a < b && -a > b && abs(a) == -a);
+	BOOST_CHECK_THROW(a / BigInt(0), std::overflow_error);
+
+	// (x + 1)^64 has central coefficient C(64, 32), past long long.
+	Polynomial<BigInt> p({ { 1, 1 }, { 0, 1 } });
+	Polynomial<BigInt> q = p;
+	for (int i = 0; i < 6; i++)
+		q = q * q;
+	BOOST_CHECK_EQUAL(q.getDegree(), 64);
+	BOOST_CHECK_EQUAL(q[32].toString(), "1832624140942590534");
+	BOOST_CHECK_EQUAL((q * q)[64].toString(), "23951146041928082866135587776380551750");
+
+	// Kronecker substitution matches term by term multiplication, signs included.
+	Polynomial<BigInt> c, d, expected;
+	for (unsigned i = 0; i < 40; i++)
+	{
+		c.setTerm(i, pow(BigInt(3), 40 + i) * BigInt(i % 3 ? 1 : -1));
+		d.setTerm(i, BigInt(i % 5) - BigInt(2));
+	}
+	for (auto& x : c)
+		for (auto& y : d)
+			expected.setTerm(x.first + y.first, x.second * y.second);
+	BOOST_CHECK(c * d == expected);
+
+	// Exact division.
+	BOOST_CHECK(c * d / d == c);
+	BOOST_CHECK((c * d % d).getDegree() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(external_multiplication)
+{
+	Polynomial<double> a, b;
+	Polynomial<long long> c, d;
+	for (unsigned i = 0; i < 1000; i++)
+	{
+		a.setTerm(i, ((i * 37) % 101) / 10. - 5.);
+		c.setTerm(i, static_cast<long long>((i * 37) % 101) - 50);
+	}
+	for (unsigned i = 0; i < 300; i++)
+	{
+		b.setTerm(i, ((i * 53) % 97) / 10. - 5.);
+		d.setTerm(i, static_cast<long long>((i * 53) % 97) - 48);
+	}
+
+	// Small blocks, so operands span many of them.
+	ExternalOptions options;
+	options.blockSize = 64;
+	ExternalProgress last;
+	unsigned reports = 0;
+	options.progress = [&](const ExternalProgress& p) { last = p; reports++; };
+
+	// Transform based block products. A file named like scratch space is left alone.
+	std::ofstream("external_r.bin.spectra") << "keep";
+	saveCoefficients("external_a.bin", a);
+	saveCoefficients("external_b.bin", b);
+	multiplyExternal<double>("external_a.bin", "external_b.bin", "external_r.bin", options);
+	Polynomial<double> product = loadCoefficients<double>("external_r.bin"), expected = a * b;
+	BOOST_CHECK_EQUAL(product.getDegree(), 1298);
+	for (unsigned i = 0; i <= 1298; i++)
+		BOOST_CHECK_SMALL(product[i] - expected[i], 1e-9);
+
+	// One report per output block, every block pair done.
+	BOOST_CHECK_EQUAL(reports, 16 + 5 - 1);
+	BOOST_CHECK_EQUAL(last.blocksDone, last.blocksTotal);
+	BOOST_CHECK_EQUAL(last.blocksTotal, 16 * 5);
+	BOOST_CHECK_EQUAL(last.bytesWritten, 1299 * sizeof(double));
+
+	// Each block transformed once, two per FFT; the existing file survives.
+	BOOST_CHECK_EQUAL(last.transforms, 8 + 3);
+	std::string kept;
+	std::ifstream("external_r.bin.spectra") >> kept;
+	BOOST_CHECK_EQUAL(kept, "keep");
+
+	// Shorter first operand.
+	multiplyExternal<double>("external_b.bin", "external_a.bin", "external_r.bin", options);
+	product = loadCoefficients<double>("external_r.bin");
+	for (unsigned i = 0; i <= 1298; i++)
+		BOOST_CHECK_SMALL(product[i] - expected[i], 1e-9);
+
+	// Exact integer block products.
+	saveCoefficients("external_a.bin", c);
+	saveCoefficients("external_b.bin", d);
+	multiplyExternal<long long>("external_a.bin", "external_b.bin", "external_r.bin", options);
+	BOOST_CHECK(loadCoefficients<long long>("external_r.bin") == c * d);
+
+	BOOST_CHECK_THROW(multiplyExternal<double>("external_missing.bin", "external_b.bin", "external_r.bin"), std::runtime_error);
+
+	std::remove("external_a.bin");
+	std::remove("external_b.bin");
+	std::remove("external_r.bin");
+	std::remove("external_r.bin.spectra");
+}
+
+BOOST_AUTO_TEST_CASE(resultant_discriminant)
+{
+	// (x - 1)(x - 2) against x - 3 and against x - 2 (common root).
+	Polynomial<int> a({ { 2, 1 }, { 1, -3 }, { 0, 2 } });
+	BOOST_CHECK_EQUAL(resultant(a, Polynomial<int>({ { 1, 1 }, { 0, -3 } })), 2);
+	BOOST_CHECK_EQUAL(resultant(a, Polynomial<int>({ { 1, 1 }, { 0, -2 } })), 0);
+
+	// b^2 - 4c and -4p^3 - 27q^2.
+	BOOST_CHECK_EQUAL(discriminant(Polynomial<int>({ { 2, 1 }, { 1, 3 }, { 0, 1 } })), 5);
+	BOOST_CHECK_EQUAL(discriminant(Polynomial<int>({ { 3, 1 }, { 1, -2 }, { 0, 1 } })), 5);
+	BOOST_CHECK_EQUAL(discriminant(Polynomial<int>({ { 3, 1 }, { 2, -3 }, { 1, 3 }, { 0, -1 } })), 0);
+	BOOST_CHECK_THROW(discriminant(Polynomial<int>({ { 0, 4 } })), std::domain_error);
+
+	// 2^3 (x^3 + 1) mod (2x + 1) = 8 (1 - 1/8).
+	Polynomial<int> r = pseudoRemainder(Polynomial<int>({ { 3, 1 }, { 0, 1 } }), Polynomial<int>({ { 1, 2 }, { 0, 1 } }));
+	BOOST_CHECK(r == Polynomial<int>({ { 0, 7 } }));
+
+	// Sequence ends in the gcd, (x - 1), up to a constant.
+	std::vector<Polynomial<int>> prs = subresultantSequence(a, Polynomial<int>({ { 3, 1 }, { 0, -1 } }));
+	BOOST_CHECK_EQUAL(prs.back().getDegree(), 1);
+	BOOST_CHECK_EQUAL(prs.back()[1], -prs.back()[0]);
+
+	// Degree 30 with two digit coefficients: exact BigInt PRS agrees with
+	// the modular path on int coefficients, both far beyond long long.
+	Polynomial<int> c, d;
+	Polynomial<BigInt> e, f;
+	for (unsigned i = 0; i <= 30; i++)
+	{
+		c.setTerm(i, static_cast<int>((i * 37) % 41) - 20);
+		d.setTerm(i, static_cast<int>((i * 53) % 43) - 21);
+		e.setTerm(i, c[i]);
+		f.setTerm(i, d[i]);
+	}
+	const BigInt exact = resultant(e, f);
+	BOOST_CHECK(exact.bitLength() > 200);
+	BOOST_CHECK_EQUAL(resultantModular(c, d), exact);
+	BOOST_CHECK_EQUAL(resultantModular(e, f), exact);
+	BOOST_CHECK_EQUAL(discriminantModular(c), discriminant(e));
+
+	// Coefficients past the double range (2^1100) still give a finite bound.
+	const BigInt huge = pow(BigInt(2), 1100) + BigInt(1);
+	BOOST_CHECK(std::isinf(double(huge)));
+	BOOST_CHECK_CLOSE(huge.log2(), 1100., 1e-12);
+	Polynomial<BigInt> g({ { 2, 1 }, { 1, huge }, { 0, 3 } }), h({ { 1, 5 }, { 0, -huge } });
+	BOOST_CHECK_EQUAL(resultantModular(g, h), resultant(g, h));
+	BOOST_CHECK(resultant(g, h).bitLength() > 2200);
+}
+
+BOOST_AUTO_TEST_CASE(rational_function)
+{
+	// Sum of 1 / ((x + k)(x + k + 1)) telescopes to 40 / ((x + 1)(x + 41)).
+	RationalFunction<BigInt> s;
+	RationalFunction<double> t;
+	for (long long k = 1; k <= 40; k++)
+	{
+		s += RationalFunction<BigInt>(Polynomial<BigInt>({ { 0, 1 } }), Polynomial<BigInt>({ { 2, 1 }, { 1, 2 * k + 1 }, { 0, k * (k + 1) } }));
+		t += RationalFunction<double>(Polynomial<double>({ { 0, 1. } }), Polynomial<double>({ { 2, 1. }, { 1, 2. * k + 1. }, { 0, k * (k + 1.) } }));
+
+		// Cancellation is deferred, but bounded.
+		BOOST_CHECK(s.denominator().getDegree() <= 32);
+	}
+
+	s.normalize();
+	BOOST_CHECK(s.numerator() == Polynomial<BigInt>({ { 0, 40 } }));
+	BOOST_CHECK(s.denominator() == Polynomial<BigInt>({ { 2, 1 }, { 1, 42 }, { 0, 41 } }));
+
+	t.normalize();
+	BOOST_CHECK_EQUAL(t.denominator().getDegree(), 2);
+	for (double x : { -.5, 0., 2.5 })
+		BOOST_CHECK_CLOSE(t.evaluate(x), 40. / ((x + 1.) * (x + 41.)), 1e-9);
+
+	// (x^2 - 1) / (x^2 + x) * x / (x - 1) = 1, and division undoes multiplication.
+	RationalFunction<int> a(Polynomial<int>({ { 2, 1 }, { 0, -1 } }), Polynomial<int>({ { 2, 1 }, { 1, 1 } }));
+	RationalFunction<int> b(Polynomial<int>({ { 1, 1 } }), Polynomial<int>({ { 1, 1 }, { 0, -1 } }));
+	RationalFunction<int> c = a * b;
+	c.normalize();
+	BOOST_CHECK(c.numerator() == Polynomial<int>({ { 0, 1 } }));
+	BOOST_CHECK(c.denominator() == Polynomial<int>({ { 0, 1 } }));
+	BOOST_CHECK(a * b / b == a);
+	BOOST_CHECK(a - a == RationalFunction<int>());
+	BOOST_CHECK_EQUAL(a.evaluate(1), 0);
+
+	// Cheap simplifications work on the sparse terms: x^2 and the content 2
+	// come out, and polynomials already in simplest form stay shared.
+	RationalFunction<int> d(Polynomial<int>({ { 3, 2 }, { 2, 4 } }), Polynomial<int>({ { 2, -6 } }));
+	BOOST_CHECK(d.numerator() == Polynomial<int>({ { 1, -1 }, { 0, -2 } }));
+	BOOST_CHECK(d.denominator() == Polynomial<int>({ { 0, 3 } }));
+	const Polynomial<int> sparse({ { 20, 1 }, { 0, 1 } }), shifted({ { 10, 1 }, { 0, 7 } });
+	RationalFunction<int> e(sparse, shifted);
+	BOOST_CHECK(&e.numerator().begin()->second == &sparse.begin()->second);
+	BOOST_CHECK(&e.denominator().begin()->second == &shifted.begin()->second);
+
+	BOOST_CHECK_THROW(RationalFunction<int>(Polynomial<int>({ { 0, 1 } }), Polynomial<int>()), std::overflow_error);
+	BOOST_CHECK_THROW(a / RationalFunction<int>(), std::overflow_error);
+	BOOST_CHECK_THROW(b.evaluate(1), std::overflow_error);
+}
+
+BOOST_AUTO_TEST_CASE(accurate_evaluation)
+{
+	// (x - 1)^7 expanded, near its root plain Horner is all rounding error.
+	Polynomial<double> p;
+	const double binomial[] = { 1., 7., 21., 35., 35., 21., 7., 1. };
+	for (unsigned i = 0; i <= 7; i++)
+		p.setTerm(i, (7 - i) % 2 ? -binomial[i] : binomial[i]);
+
+	std::vector<double> x{ .999, 1.001, 1.01, 1.5, 3. }, y(x.size()), bounds(x.size());
+	p.evaluateAccurate(x.data(), y.data(), x.size(), bounds.data());
+
+	for (std::size_t i = 0; i < x.size(); i++)
+	{
+		// x - 1 is exact, so pow gives the true value to rounding.
+		const double exact = std::pow(x[i] - 1., 7);
+		double bound;
+		BOOST_CHECK_EQUAL(p.evaluateAccurate(x[i], &bound), y[i]);
+		BOOST_CHECK_EQUAL(bound, bounds[i]);
+		BOOST_CHECK_CLOSE(y[i], exact, 1e-6);
+		BOOST_CHECK(std::abs(y[i] - exact) <= bounds[i] + 4 * std::numeric_limits<double>::epsilon() * std::abs(exact));
+	}
+
+	BOOST_CHECK_EQUAL(Polynomial<double>().evaluateAccurate(2.), 0.);
+}
+
+BOOST_AUTO_TEST_CASE(multivariate)
+{
+	// (x0 + x1 + 1)^2 = x0^2 + 2x0x1 + x1^2 + 2x0 + 2x1 + 1.
+	const MultiPolynomial<int> x0 = MultiPolynomial<int>::variable(3, 0), x1 = MultiPolynomial<int>::variable(3, 1);
+	const MultiPolynomial<int> one(3, { { { 0, 0, 0 }, 1 } });
+	MultiPolynomial<int> s = x0 + x1 + one;
+	MultiPolynomial<int> sq = s * s;
+	BOOST_CHECK_EQUAL(sq.size(), 6);
+	BOOST_CHECK_EQUAL(sq.getDegree(), 2);
+	BOOST_CHECK_EQUAL(sq.getTerm({ 1, 1, 0 }), 2);
+	BOOST_CHECK_EQUAL(sq.getTerm({ 0, 2, 0 }), 1);
+	BOOST_CHECK_EQUAL(sq.getTerm({ 0, 0, 1 }), 0);
+	BOOST_CHECK(sq - s * s == MultiPolynomial<int>(3));
+	BOOST_CHECK(s * (x0 - x1) == x0 * x0 - x1 * x1 + x0 - x1);
+
+	// Horner evaluation against the factored form.
+	MultiPolynomial<int> cube = sq * s * MultiPolynomial<int>::variable(3, 2);
+	BOOST_CHECK_EQUAL(cube.evaluate({ 2, -3, 5 }), 0);
+	BOOST_CHECK_EQUAL(cube.evaluate({ 2, 3, 5 }), 216 * 5);
+	BOOST_CHECK_EQUAL(MultiPolynomial<int>(3).evaluate({ 1, 2, 3 }), 0);
+
+	// Conversion to and from one variable.
+	const Polynomial<int> p({ { 0, 1 }, { 3, -2 }, { 5, 4 } });
+	MultiPolynomial<int> q = MultiPolynomial<int>::fromPolynomial(p, 3, 1);
+	BOOST_CHECK(q.toPolynomial(1) == p);
+	BOOST_CHECK_THROW(q.toPolynomial(0), std::domain_error);
+	BOOST_CHECK_EQUAL(q.evaluate({ 7, 2, 7 }), p.evaluate(2));
+	// Substituting x0 = 2, x2 = 5 in (x0 + x1 + 1)^2 x2 gives 5(x1 + 3)^2.
+	BOOST_CHECK((sq * MultiPolynomial<int>::variable(3, 2)).toPolynomial(1, { 2, 0, 5 }) == Polynomial<int>({ { 2, 5 }, { 1, 30 }, { 0, 45 } }));
+
+	// Sixteen variables hold exponents up to 7, overflow throws.
+	MultiPolynomial<double> y(16);
+	BOOST_CHECK_EQUAL(y.maxExponent(), 7);
+	MultiPolynomial<double> y15 = MultiPolynomial<double>::variable(16, 15);
+	MultiPolynomial<double> y15Power = y15 * y15 * y15 * y15 * y15 * y15 * y15;
+	BOOST_CHECK_EQUAL(y15Power.evaluate(std::vector<double>(16, 2.)), 128.);
+	BOOST_CHECK_THROW(y15Power * y15, std::overflow_error);
+	BOOST_CHECK_THROW(MultiPolynomial<double>(17), std::domain_error);
+	BOOST_CHECK_THROW(x0 * MultiPolynomial<int>::variable(2, 0), std::domain_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
@@ -0,0 +1,329 @@
+/*************************************************************************
+* Title: Power Series Class
+* File: power_series.h
+* Date: 10/19/2026
+*
+* Truncated power series over the coefficients of a Polynomial, i.e. a
+* polynomial taken modulo x^n. The truncation order n is fixed at
+* construction, so multiplication computes only the low n coefficients
+* of the product (short product) instead of the full product.
+*
+* Notes:
+*  (1) inverse, log, exp and sqrt use Newton iteration, doubling the
+*      precision every step, for a total cost of O(M(n)).
+*  (2) inverse, log, exp and sqrt divide coefficients, so T should be a
+*      field (double, a modular integer type, etc.).
+*************************************************************************
+* Change Log:
+*   10/19/2026: Initial release.
+*************************************************************************/
+#pragma once
+
+#include <vector>    // coefficients
+#include <stdexcept> // domain_error
+#include <algorithm> // min, copy
+#include <type_traits>
+#include <cmath>     // sqrt
+
+#include "polynomial.h"
+
+template<typename T>
+class PowerSeries
+{
+private:
+	// Coefficients of x^0 ... x^(order - 1), always order entries.
+	std::vector<T> coefficients;
+
+	// Series length below which the short product is computed directly.
+	static const std::size_t shortProductCutoff = 32;
+
+	// Low n coefficients of the product of two coefficient arrays.
+	static std::vector<T> shortProduct(const std::vector<T>& a, const std::vector<T>& b, const std::size_t n);
+
+	// Construct from coefficients, padded or truncated to n terms.
+	PowerSeries(std::vector<T> c, const std::size_t n) : coefficients(std::move(c)) { coefficients.resize(n, T{ 0 }); }
+
+public:
+	// Zero series of given truncation order.
+	explicit PowerSeries(const std::size_t order) : coefficients(order, T{ 0 }) { }
+	// Truncate polynomial to given order.
+	PowerSeries(const Polynomial<T>& p, const std::size_t order);
+	// Default destructor.
+	~PowerSeries() = default;
+
+	// Getter function for truncation order.
+	std::size_t getOrder() const { return coefficients.size(); }
+
+	// Return series coefficient at exponent index.
+	T operator[] (const std::size_t exponent) const { return coefficients.at(exponent); }
+	// Set series coefficient at exponent index.
+	T& operator[] (const std::size_t exponent) { return coefficients.at(exponent); }
+
+	// Convert to polynomial of degree < order.
+	Polynomial<T> toPolynomial() const { return Polynomial<T>::fromDense(coefficients); }
+	// Change truncation order, padding with zero terms when growing.
+	PowerSeries truncate(const std::size_t order) const { return PowerSeries(coefficients, order); }
+
+	// Formal derivative, order drops by one.
+	PowerSeries derivative() const;
+	// Formal integral with zero constant term, order grows by one.
+	PowerSeries integral() const;
+
+	// Multiplicative inverse, requires a non-zero constant term.
+	PowerSeries inverse() const;
+	// Logarithm, requires a constant term of one.
+	PowerSeries log() const;
+	// Exponential, requires a zero constant term.
+	PowerSeries exp() const;
+	// Square root, requires a constant term of one (or positive for floating point).
+	PowerSeries sqrt() const;
+
+	// Add series, result has the smaller order of the two.
+	PowerSeries operator+ (const PowerSeries& rhs) const
+	{
+		PowerSeries result = truncate(std::min(getOrder(), rhs.getOrder()));
+
+		for (std::size_t i = 0; i < result.getOrder(); i++)
+			result.coefficients[i] += rhs.coefficients[i];
+
+		return result;
+	}
+
+	// Subtract series, result has the smaller order of the two.
+	PowerSeries operator- (const PowerSeries& rhs) const
+	{
+		PowerSeries result = truncate(std::min(getOrder(), rhs.getOrder()));
+
+		for (std::size_t i = 0; i < result.getOrder(); i++)
+			result.coefficients[i] -= rhs.coefficients[i];
+
+		return result;
+	}
+
+	// Multiply series via short product, result has the smaller order of the two.
+	PowerSeries operator* (const PowerSeries& rhs) const
+	{
+		const std::size_t n = std::min(getOrder(), rhs.getOrder());
+
+		return PowerSeries(shortProduct(coefficients, rhs.coefficients, n), n);
+	}
+
+	// Overloaded unary minus operator.
+	PowerSeries operator- () const
+	{
+		PowerSeries result = *this;
+
+		for (auto& c : result.coefficients)
+			c = -c;
+
+		return result;
+	}
+
+	PowerSeries& operator+= (const PowerSeries& rhs) { return *this = *this + rhs; }
+	PowerSeries& operator-= (const PowerSeries& rhs) { return *this = *this - rhs; }
+	PowerSeries& operator*= (const PowerSeries& rhs) { return *this = *this * rhs; }
+
+	// Stream series, followed by its truncation order.
+	friend std::ostream& operator<< (std::ostream& os, const PowerSeries& s)
+	{
+		return os << s.toPolynomial() << " + O(x^" << s.getOrder() << ")";
+	}
+};
+
+// Truncate polynomial to given order.
+template<typename T>
+PowerSeries<T>::PowerSeries(const Polynomial<T>& p, const std::size_t order) : coefficients(order, T{ 0 })
+{
+	for (auto& t : p)
+	{
+		if (t.first >= order)
+			break;
+		coefficients[t.first] = t.second;
+	}
+}
+
+// Low n coefficients of the product of two coefficient arrays.
+//
+// Mulders' split: with a = a0 + x^m a1 and b = b0 + x^m b1, 2m >= n gives
+//   a * b mod x^n = a0 * b0 + x^m (a1 * b0 + a0 * b1) mod x^n,
+// where a0 * b0 is a full (Karatsuba) product and the cross terms are
+// recursive short products of length n - m. A split near 0.7n is faster
+// than halving since the full product is the cheaper part.
+template<typename T>
+std::vector<T> PowerSeries<T>::shortProduct(const std::vector<T>& a, const std::vector<T>& b, const std::size_t n)
+{
+	std::vector<T> result(n, T{ 0 });
+	const std::size_t na = std::min(a.size(), n);
+	const std::size_t nb = std::min(b.size(), n);
+
+	if (na == 0 || nb == 0)
+		return result;
+
+	// Schoolbook, skipping every product at or above x^n.
+	if (n <= shortProductCutoff)
+	{
+		for (std::size_t i = 0; i < na; i++)
+			for (std::size_t j = 0; j < nb && i + j < n; j++)
+				result[i + j] += a[i] * b[j];
+
+		return result;
+	}
+
+	const std::size_t m = (7 * n + 9) / 10;
+	const std::size_t rest = n - m;
+
+	// Full product of the low halves.
+	const std::vector<T> low = Polynomial<T>::denseMultiply(
+		std::vector<T>(a.begin(), a.begin() + std::min(na, m)),
+		std::vector<T>(b.begin(), b.begin() + std::min(nb, m)));
+	std::copy(low.begin(), low.begin() + std::min(low.size(), n), result.begin());
+
+	// Cross terms, a1 * b0 and a0 * b1.
+	if (na > m)
+	{
+		const std::vector<T> cross = shortProduct(std::vector<T>(a.begin() + m, a.begin() + na), b, rest);
+		for (std::size_t i = 0; i < rest; i++)
+			result[m + i] += cross[i];
+	}
+	if (nb > m)
+	{
+		const std::vector<T> cross = shortProduct(a, std::vector<T>(b.begin() + m, b.begin() + nb), rest);
+		for (std::size_t i = 0; i < rest; i++)
+			result[m + i] += cross[i];
+	}
+
+	return result;
+}
+
+// Formal derivative, order drops by one.
+template<typename T>
+PowerSeries<T> PowerSeries<T>::derivative() const
+{
+	PowerSeries<T> result(getOrder() ? getOrder() - 1 : 0);
+
+	for (std::size_t i = 1; i < getOrder(); i++)
+		result.coefficients[i - 1] = coefficients[i] * T(i);
+
+	return result;
+}
+
+// Formal integral with zero constant term, order grows by one.
+template<typename T>
+PowerSeries<T> PowerSeries<T>::integral() const
+{
+	PowerSeries<T> result(getOrder() + 1);
+
+	for (std::size_t i = 0; i < getOrder(); i++)
+		result.coefficients[i + 1] = coefficients[i] / T(i + 1);
+
+	return result;
+}
+
+// Multiplicative inverse, requires a non-zero constant term.
+//
+// Newton iteration g' = g (2 - f g), doubling the correct terms each step.
+template<typename T>
+PowerSeries<T> PowerSeries<T>::inverse() const
+{
+	if (getOrder() == 0)
+		return *this;
+
+	if (coefficients[0] == T{ 0 })
+		throw std::domain_error("Inverse of series with zero constant term");
+
+	std::vector<T> g{ T{ 1 } / coefficients[0] };
+
+	for (std::size_t k = 1; k < getOrder(); )
+	{
+		k = std::min(2 * k, getOrder());
+
+		// e = 2 - f g.
+		std::vector<T> e = shortProduct(coefficients, g, k);
+		for (auto& c : e)
+			c = -c;
+		e[0] += T{ 2 };
+
+		g = shortProduct(g, e, k);
+	}
+
+	return PowerSeries<T>(std::move(g), getOrder());
+}
+
+// Logarithm, requires a constant term of one.
+//
+// log f = integral(f' / f).
+template<typename T>
+PowerSeries<T> PowerSeries<T>::log() const
+{
+	if (getOrder() == 0)
+		return *this;
+
+	if (coefficients[0] != T{ 1 })
+		throw std::domain_error("Log of series with constant term not one");
+
+	return (derivative() * truncate(getOrder() - 1).inverse()).integral();
+}
+
+// Exponential, requires a zero constant term.
+//
+// Newton iteration g' = g (1 + f - log g), doubling the correct terms each step.
+template<typename T>
+PowerSeries<T> PowerSeries<T>::exp() const
+{
+	if (getOrder() == 0)
+		return *this;
+
+	if (coefficients[0] != T{ 0 })
+		throw std::domain_error("Exp of series with non-zero constant term");
+
+	PowerSeries<T> g(std::vector<T>{ T{ 1 } }, 1);
+
+	for (std::size_t k = 1; k < getOrder(); )
+	{
+		k = std::min(2 * k, getOrder());
+		g = g.truncate(k);
+
+		// e = 1 + f - log g.
+		PowerSeries<T> e = truncate(k) - g.log();
+		e.coefficients[0] += T{ 1 };
+
+		g *= e;
+	}
+
+	return g;
+}
+
+// Square root, requires a constant term of one (or positive for floating point).
+//
+// Newton iteration g' = (g + f / g) / 2, doubling the correct terms each step.
+template<typename T>
+PowerSeries<T> PowerSeries<T>::sqrt() const
+{
+	if (getOrder() == 0)
+		return *this;
+
+	T root{ 1 };
+
+	if constexpr (std::is_floating_point<T>::value)
+	{
+		if (!(coefficients[0] > T{ 0 }))
+			throw std::domain_error("Square root of series with non-positive constant term");
+		root = std::sqrt(coefficients[0]);
+	}
+	else if (coefficients[0] != T{ 1 })
+		throw std::domain_error("Square root of series with constant term not one");
+
+	PowerSeries<T> g(std::vector<T>{ root }, 1);
+
+	for (std::size_t k = 1; k < getOrder(); )
+	{
+		k = std::min(2 * k, getOrder());
+		g = g.truncate(k);
+		g += truncate(k) * g.inverse();
+
+		for (auto& c : g.coefficients)
+			c = c / T{ 2 };
+	}
+
+	return g;
+}
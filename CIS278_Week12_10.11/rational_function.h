@@ -0,0 +1,392 @@
+/*************************************************************************
+* Title: Rational Function Class
+* File: rational_function.h
+* Date: 10/19/2026
+*
+* Ratio p / q of two Polynomials, with arithmetic and evaluation.
+*
+* Notes:
+*  (1) Cancellation of gcd(p, q) is deferred. Every operation only does
+*      cheap simplifications on the sparse terms: dividing out a common
+*      power of x and the coefficient content, reusing an equal
+*      denominator in sums. The gcd, the only dense step, is cancelled
+*      once the combined degree passes a limit, which then doubles from
+*      the reduced size, or when normalize is called.
+*  (2) Integer coefficients (including BigInt) use the subresultant PRS
+*      for the gcd and cancel exactly. Floating point coefficients use the
+*      Euclidean algorithm with a relative tolerance, so nearly common
+*      factors cancel as well.
+*  (3) Numerator and denominator are exposed as they are; call normalize
+*      first for the lowest terms form.
+*************************************************************************
+* Change Log:
+*   10/19/2026: Initial release.
+*   10/19/2026: Simplifications between gcd cancellations stay sparse.
+*************************************************************************/
+#pragma once
+
+#include <vector>    // dense coefficients
+#include <cmath>     // abs, sqrt
+#include <limits>    // epsilon
+#include <stdexcept> // overflow_error
+#include <algorithm> // max, min
+#include <type_traits>
+
+#include "polynomial.h"
+#include "polynomial_roots.h"
+#include "polynomial_resultant.h"
+
+namespace detail
+{
+	// True when every term of p is null.
+	template<typename T>
+	bool isZero(const Polynomial<T>& p)
+	{
+		return std::all_of(p.begin(), p.end(), [](const std::pair<const unsigned, T>& t) { return t.second == T{ 0 }; });
+	}
+
+	// Quotient of a by b, when b divides a (remainder dropped).
+	template<typename T>
+	std::vector<T> exactQuotient(std::vector<T> a, const std::vector<T>& b)
+	{
+		if (a.size() < b.size())
+			return std::vector<T>();
+
+		std::vector<T> q(a.size() - b.size() + 1, T{ 0 });
+
+		while (a.size() >= b.size())
+		{
+			const T c = a.back() / b.back();
+			const std::size_t offset = a.size() - b.size();
+
+			q[offset] = c;
+			for (std::size_t i = 0; i < b.size(); i++)
+				a[offset + i] -= c * b[i];
+			a.pop_back();
+		}
+
+		return q;
+	}
+
+	// Greatest common divisor of polynomials a and b, both non-zero.
+	template<typename T>
+	std::vector<T> polynomialGcd(std::vector<T> a, std::vector<T> b)
+	{
+		if constexpr (std::is_floating_point<T>::value)
+		{
+			// Euclid on coefficients scaled to unit size, dropping remainder
+			// coefficients lost to rounding.
+			const T tolerance = std::sqrt(std::numeric_limits<T>::epsilon());
+			auto scale = [](std::vector<T>& x)
+			{
+				T largest{ 0 };
+				for (auto& c : x)
+					largest = std::max(largest, std::abs(c));
+				for (auto& c : x)
+					c /= largest;
+			};
+
+			scale(a);
+			scale(b);
+			if (a.size() < b.size())
+				a.swap(b);
+
+			while (b.size() > 1)
+			{
+				const T inverse = T{ 1 } / b.back();
+				while (a.size() >= b.size())
+				{
+					const T c = a.back() * inverse;
+					const std::size_t offset = a.size() - b.size();
+					for (std::size_t i = 0; i < b.size(); i++)
+						a[offset + i] -= c * b[i];
+					a.pop_back();
+				}
+
+				while (!a.empty() && std::abs(a.back()) <= tolerance)
+					a.pop_back();
+				if (a.empty())
+					return b;
+
+				scale(a);
+				a.swap(b);
+			}
+
+			return std::vector<T>{ T{ 1 } };
+		}
+		else
+		{
+			// Last subresultant, made primitive.
+			if (a.size() < b.size())
+				a.swap(b);
+
+			std::vector<T> g = a;
+			if (b.size() > 1)
+			{
+				std::vector<std::vector<T>> prs;
+				subresultant(a, b, &prs);
+				g = prs.back();
+			}
+			else
+				g = b;
+
+			if (g.size() == 1)
+				return std::vector<T>{ T{ 1 } };
+
+			removeContent(g);
+
+			return g;
+		}
+	}
+}
+
+template<typename T>
+class RationalFunction
+{
+private:
+	// Numerator and denominator, the denominator never zero.
+	Polynomial<T> num, den;
+
+	// Combined degree at which the gcd is cancelled.
+	std::size_t limit = cancelThreshold;
+
+	// Smallest cancellation limit.
+	static const std::size_t cancelThreshold = 32;
+
+	// Construct with given limit and simplify.
+	RationalFunction(const Polynomial<T>& n, const Polynomial<T>& d, const std::size_t l);
+
+	// Cheap simplifications: common power of x and content.
+	void tidy();
+	// Tidy, and cancel the gcd once the limit is passed.
+	void update();
+	// Combined degree.
+	std::size_t size() const { return std::size_t{ num.getDegree() } + den.getDegree(); }
+
+public:
+	// Zero.
+	RationalFunction() : den({ { 0, T{ 1 } } }) { }
+	// Polynomial over one.
+	RationalFunction(const Polynomial<T>& p) : num(p), den({ { 0, T{ 1 } } }) { tidy(); }
+	// Ratio p / q, throws on a zero denominator.
+	RationalFunction(const Polynomial<T>& p, const Polynomial<T>& q);
+
+	// Getter functions for numerator and denominator.
+	const Polynomial<T>& numerator() const { return num; }
+	const Polynomial<T>& denominator() const { return den; }
+
+	// Cancel the gcd now, leaving lowest terms.
+	void normalize();
+
+	// Evaluate at x, throws where the denominator vanishes.
+	T evaluate(const T x) const;
+
+	// Add rational functions.
+	RationalFunction operator+ (const RationalFunction& rhs) const;
+	// Subtract rational functions.
+	RationalFunction operator- (const RationalFunction& rhs) const;
+	// Multiply rational functions.
+	RationalFunction operator* (const RationalFunction& rhs) const;
+	// Divide rational functions, throws on a zero divisor.
+	RationalFunction operator/ (const RationalFunction& rhs) const;
+	// Overloaded unary minus operator.
+	RationalFunction operator- () const { return RationalFunction(-num, den, limit); }
+
+	RationalFunction& operator+= (const RationalFunction& rhs) { return *this = *this + rhs; }
+	RationalFunction& operator-= (const RationalFunction& rhs) { return *this = *this - rhs; }
+	RationalFunction& operator*= (const RationalFunction& rhs) { return *this = *this * rhs; }
+	RationalFunction& operator/= (const RationalFunction& rhs) { return *this = *this / rhs; }
+
+	// Equal as functions, by cross multiplication (no gcd needed).
+	bool operator== (const RationalFunction& rhs) const { return num * rhs.den == rhs.num * den; }
+	bool operator!= (const RationalFunction& rhs) const { return !(*this == rhs); }
+
+	// Stream as (numerator) / (denominator).
+	friend std::ostream& operator<< (std::ostream& os, const RationalFunction& r)
+	{
+		return os << "(" << r.num << ") / (" << r.den << ")";
+	}
+};
+
+// Construct with given limit and simplify.
+template<typename T>
+RationalFunction<T>::RationalFunction(const Polynomial<T>& n, const Polynomial<T>& d, const std::size_t l) : num(n), den(d), limit(l)
+{
+	update();
+}
+
+// Ratio p / q, throws on a zero denominator.
+template<typename T>
+RationalFunction<T>::RationalFunction(const Polynomial<T>& p, const Polynomial<T>& q) : num(p), den(q)
+{
+	if (detail::isZero(q))
+		throw std::overflow_error("Divide by zero");
+
+	update();
+}
+
+// Cheap simplifications: common power of x and content.
+//
+// Integer coefficients lose their common factor and the denominator's
+// leading coefficient is made positive. Floating point ones are scaled
+// so the denominator is monic. Only the terms present are visited, and
+// the polynomials are left alone (still shared) when nothing changes.
+template<typename T>
+void RationalFunction<T>::tidy()
+{
+	if (detail::isZero(num))
+	{
+		T c{ 0 };
+		if (den.getDegree() != 0 || !den.getTerm(0, c) || c != T{ 1 })
+			den = Polynomial<T>({ { 0, T{ 1 } } });
+		return;
+	}
+
+	// Common power of x, the lowest exponent with a non-null term.
+	unsigned shift = std::max(num.getDegree(), den.getDegree());
+	for (const Polynomial<T>* p : { &num, &den })
+		for (auto& t : *p)
+			if (t.second != T{ 0 })
+			{
+				shift = std::min(shift, t.first);
+				break;
+			}
+
+	// Content and sign.
+	T lead{ 0 };
+	den.getTerm(den.getDegree(), lead);
+
+	T factor{ 1 };
+	if constexpr (std::is_floating_point<T>::value)
+		factor = lead;
+	else
+	{
+		T g{ 0 };
+		for (const Polynomial<T>* p : { &num, &den })
+			for (auto& t : *p)
+			{
+				T y = t.second < T{ 0 } ? -t.second : t.second;
+				while (y != T{ 0 } && g != T{ 1 })
+				{
+					T r = g % y;
+					g = y;
+					y = r;
+				}
+			}
+
+		factor = lead < T{ 0 } ? -g : g;
+	}
+
+	if (shift == 0 && factor == T{ 1 })
+		return;
+
+	// Rebuild term by term, dropping null terms.
+	auto reduce = [shift, &factor](const Polynomial<T>& p)
+	{
+		Polynomial<T> result;
+		for (auto& t : p)
+			if (t.second != T{ 0 })
+				result.setTerm(t.first - shift, t.second / factor);
+
+		return result;
+	};
+
+	num = reduce(num);
+	den = reduce(den);
+}
+
+// Tidy, and cancel the gcd once the limit is passed.
+template<typename T>
+void RationalFunction<T>::update()
+{
+	tidy();
+
+	if (size() > limit)
+		normalize();
+}
+
+// Cancel the gcd now, leaving lowest terms.
+template<typename T>
+void RationalFunction<T>::normalize()
+{
+	tidy();
+
+	const std::vector<T> n = detail::trimmedDense(num), d = detail::trimmedDense(den);
+
+	if (!n.empty() && n.size() > 1 && d.size() > 1)
+	{
+		const std::vector<T> g = detail::polynomialGcd(n, d);
+
+		if (g.size() > 1)
+		{
+			num = Polynomial<T>::fromDense(detail::exactQuotient(n, g));
+			den = Polynomial<T>::fromDense(detail::exactQuotient(d, g));
+			tidy();
+		}
+	}
+
+	// Next cancellation once the reduced size has doubled.
+	limit = (2 * size() > cancelThreshold) ? 2 * size() : cancelThreshold;
+}
+
+// Evaluate at x, throws where the denominator vanishes.
+template<typename T>
+T RationalFunction<T>::evaluate(const T x) const
+{
+	const T d = den.evaluate(x);
+
+	if (d == T{ 0 })
+		throw std::overflow_error("Divide by zero");
+
+	return num.evaluate(x) / d;
+}
+
+// Add rational functions.
+template<typename T>
+RationalFunction<T> RationalFunction<T>::operator+ (const RationalFunction<T>& rhs) const
+{
+	const std::size_t l = std::max(limit, rhs.limit);
+
+	// Equal denominators (often shared copies, compared by fingerprint) add directly.
+	if (den == rhs.den)
+		return RationalFunction<T>(num + rhs.num, den, l);
+
+	return RationalFunction<T>(num * rhs.den + rhs.num * den, den * rhs.den, l);
+}
+
+// Subtract rational functions.
+template<typename T>
+RationalFunction<T> RationalFunction<T>::operator- (const RationalFunction<T>& rhs) const
+{
+	return *this + (-rhs);
+}
+
+// Multiply rational functions.
+template<typename T>
+RationalFunction<T> RationalFunction<T>::operator* (const RationalFunction<T>& rhs) const
+{
+	const std::size_t l = std::max(limit, rhs.limit);
+
+	// A denominator equal to the other numerator cancels outright.
+	if (den == rhs.num)
+		return RationalFunction<T>(num, rhs.den, l);
+	if (num == rhs.den)
+		return RationalFunction<T>(rhs.num, den, l);
+
+	return RationalFunction<T>(num * rhs.num, den * rhs.den, l);
+}
+
+// Divide rational functions, throws on a zero divisor.
+template<typename T>
+RationalFunction<T> RationalFunction<T>::operator/ (const RationalFunction<T>& rhs) const
+{
+	if (detail::isZero(rhs.num))
+		throw std::overflow_error("Divide by zero");
+
+	RationalFunction<T> reciprocal;
+	reciprocal.num = rhs.den;
+	reciprocal.den = rhs.num;
+	reciprocal.limit = rhs.limit;
+
+	return *this * reciprocal;
+}